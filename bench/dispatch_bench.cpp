@@ -0,0 +1,36 @@
+#include <benchmark/benchmark.h>
+
+#include "device/hashers/ecmp_hasher.hpp"
+#include "utils.hpp"
+
+namespace bench {
+
+static const std::size_t FLOWS_COUNT = 1024;
+
+// ECMP hash as routing module calls it after freeze: exact type is known, so
+// call is inlined
+static void BM_EcmpHashStatic(benchmark::State& state) {
+    sim::ECMPHasher hasher;
+    const std::vector<sim::Packet> packets = create_packets(FLOWS_COUNT);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hasher.get_hash(packets[i++ % FLOWS_COUNT]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EcmpHashStatic);
+
+// Same hasher and packets through IPacketHasher, as before freeze
+static void BM_EcmpHashVirtual(benchmark::State& state) {
+    std::unique_ptr<sim::IPacketHasher> hasher =
+        std::make_unique<sim::ECMPHasher>();
+    const std::vector<sim::Packet> packets = create_packets(FLOWS_COUNT);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hasher->get_hash(packets[i++ % FLOWS_COUNT]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EcmpHashVirtual);
+
+}  // namespace bench
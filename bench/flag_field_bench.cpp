@@ -0,0 +1,49 @@
+#include <benchmark/benchmark.h>
+
+#include "utils/avg_rtt_packet_flag.hpp"
+#include "utils/flag_field.hpp"
+
+namespace bench {
+
+// Same layout as flags of TCP packets
+using TypeFlag = sim::NextFlagField<sim::AvgRttFlag, 2>;
+using TtlFlag = sim::NextFlagField<TypeFlag, 5>;
+
+static void BM_FlagFieldSet(benchmark::State& state) {
+    sim::BaseBitset flags;
+    PacketFlagsBase value = 0;
+    for (auto _ : state) {
+        TypeFlag::set(flags, value & 3);
+        TtlFlag::set(flags, value & 31);
+        value++;
+        benchmark::DoNotOptimize(flags);
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_FlagFieldSet);
+
+static void BM_FlagFieldGet(benchmark::State& state) {
+    sim::BaseBitset flags;
+    TypeFlag::set(flags, 2);
+    TtlFlag::set(flags, 17);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(TypeFlag::get(flags));
+        benchmark::DoNotOptimize(TtlFlag::get(flags));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_FlagFieldGet);
+
+static void BM_AvgRttFlagSetGet(benchmark::State& state) {
+    sim::BaseBitset flags;
+    TimeNs rtt(1000);
+    for (auto _ : state) {
+        sim::set_avg_rtt_flag(flags, rtt);
+        benchmark::DoNotOptimize(sim::get_avg_rtt_flag(flags));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AvgRttFlagSetGet);
+
+}  // namespace bench
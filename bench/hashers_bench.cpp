@@ -0,0 +1,36 @@
+#include <benchmark/benchmark.h>
+
+#include "device/hashers/adaptive_flowlet_hasher.hpp"
+#include "device/hashers/ecmp_hasher.hpp"
+#include "device/hashers/flowlet_hasher.hpp"
+#include "device/hashers/random_hasher.hpp"
+#include "device/hashers/salt_ecmp_hasher.hpp"
+#include "device/hashers/symmetric_hasher.hpp"
+#include "utils.hpp"
+
+namespace bench {
+
+static const std::size_t FLOWS_COUNT = 4096;
+
+// Hasher is called through IPacketHasher like in routing module before freeze
+template <typename THasher>
+static void BM_Hasher(benchmark::State& state, THasher hasher) {
+    std::unique_ptr<sim::IPacketHasher> packet_hasher =
+        std::make_unique<THasher>(std::move(hasher));
+    const std::vector<sim::Packet> packets = create_packets(FLOWS_COUNT);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            packet_hasher->get_hash(packets[i++ % FLOWS_COUNT]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_CAPTURE(BM_Hasher, ecmp, sim::ECMPHasher());
+BENCHMARK_CAPTURE(BM_Hasher, salt_ecmp, sim::SaltECMPHasher("switch"));
+BENCHMARK_CAPTURE(BM_Hasher, symmetric, sim::SymmetricHasher());
+BENCHMARK_CAPTURE(BM_Hasher, random, sim::RandomHasher());
+BENCHMARK_CAPTURE(BM_Hasher, flowlet, sim::FLowletHasher(TimeNs(1000)));
+BENCHMARK_CAPTURE(BM_Hasher, adaptive_flowlet, sim::AdaptiveFlowletHasher());
+
+}  // namespace bench
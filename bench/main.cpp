@@ -0,0 +1,17 @@
+#include <benchmark/benchmark.h>
+
+#include "logger/logger.hpp"
+
+int main(int argc, char** argv) {
+    // Primitives log on some paths (e.g. queue overflow); writing logs is not
+    // what is measured
+    Logger::get_instance().disable_logs();
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include "utils.hpp"
+#include "utils/packet_num_monitor.hpp"
+
+namespace bench {
+
+static const std::size_t PACKETS_COUNT = 1 << 16;
+
+// Confirms packets in order, as receiver without reordering does
+static void BM_PacketNumMonitorInOrder(benchmark::State& state) {
+    for (auto _ : state) {
+        sim::PacketNumMonitor monitor;
+        for (PacketNum i = 0; i < PACKETS_COUNT; i++) {
+            benchmark::DoNotOptimize(monitor.confirm_one(i));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * PACKETS_COUNT);
+}
+BENCHMARK(BM_PacketNumMonitorInOrder);
+
+// Packets are shuffled inside blocks of range(0) packets, as after spraying
+// over paths with different delays
+static void BM_PacketNumMonitorReordered(benchmark::State& state) {
+    const std::size_t block_size = state.range(0);
+    std::vector<PacketNum> order(PACKETS_COUNT);
+    std::iota(order.begin(), order.end(), 0);
+    std::mt19937 generator(RANDOM_SEED);
+    for (std::size_t first = 0; first < PACKETS_COUNT; first += block_size) {
+        std::size_t last = std::min(first + block_size, PACKETS_COUNT);
+        std::shuffle(order.begin() + first, order.begin() + last, generator);
+    }
+    for (auto _ : state) {
+        sim::PacketNumMonitor monitor;
+        for (PacketNum packet_num : order) {
+            benchmark::DoNotOptimize(monitor.confirm_one(packet_num));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * PACKETS_COUNT);
+}
+BENCHMARK(BM_PacketNumMonitorReordered)
+    ->ArgName("block")
+    ->RangeMultiplier(8)
+    ->Range(8, 4096);
+
+// Cumulative confirmations every range(0) packets
+static void BM_PacketNumMonitorConfirmTo(benchmark::State& state) {
+    const std::size_t step = state.range(0);
+    for (auto _ : state) {
+        sim::PacketNumMonitor monitor;
+        for (PacketNum i = step - 1; i < PACKETS_COUNT; i += step) {
+            benchmark::DoNotOptimize(monitor.confirm_to(i));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * PACKETS_COUNT);
+}
+BENCHMARK(BM_PacketNumMonitorConfirmTo)
+    ->ArgName("step")
+    ->RangeMultiplier(8)
+    ->Range(1, 512);
+
+static void BM_PacketNumMonitorIsConfirmed(benchmark::State& state) {
+    sim::PacketNumMonitor monitor;
+    for (PacketNum i = 0; i < PACKETS_COUNT; i += 2) {
+        monitor.confirm_one(i);
+    }
+    PacketNum i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(monitor.is_confirmed(i++ % PACKETS_COUNT));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PacketNumMonitorIsConfirmed);
+
+}  // namespace bench
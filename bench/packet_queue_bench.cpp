@@ -0,0 +1,37 @@
+#include <benchmark/benchmark.h>
+
+#include "link/packet_queue/simple_packet_queue.hpp"
+#include "utils.hpp"
+
+namespace bench {
+
+// Queue keeps range(0) packets; every iteration pushes one and pops one
+static void BM_SimplePacketQueuePushPop(benchmark::State& state) {
+    const std::size_t depth = state.range(0);
+    const sim::Packet packet = create_packets(1).front();
+    sim::SimplePacketQueue queue((depth + 1) * packet.size);
+    for (std::size_t i = 0; i < depth; i++) {
+        queue.push(packet);
+    }
+    for (auto _ : state) {
+        queue.push(packet);
+        benchmark::DoNotOptimize(queue.front());
+        queue.pop();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SimplePacketQueuePushPop)->ArgName("depth")->Range(1, 1 << 12);
+
+// Every push is rejected because the queue is full
+static void BM_SimplePacketQueueOverflow(benchmark::State& state) {
+    const sim::Packet packet = create_packets(1).front();
+    sim::SimplePacketQueue queue(packet.size);
+    queue.push(packet);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(queue.push(packet));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SimplePacketQueueOverflow);
+
+}  // namespace bench
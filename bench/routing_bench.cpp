@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include "utils.hpp"
+#include "utils/algorithms.hpp"
+
+namespace bench {
+
+// Switch with range(0) ports, all of them are equal-cost paths to destination
+struct EcmpSwitch {
+    explicit EcmpSwitch(std::size_t ports_count)
+        : device(std::make_shared<sim::Switch>("switch")) {
+        for (std::size_t i = 0; i < ports_count; i++) {
+            neighbours.push_back(
+                std::make_shared<sim::Switch>("neighbour" + std::to_string(i)));
+            auto link = std::make_shared<sim::Link>("link" + std::to_string(i),
+                                                    device, neighbours.back());
+            device->add_outlink(link);
+            device->update_routing_table("receiver", link);
+            links.push_back(std::move(link));
+        }
+    }
+
+    std::shared_ptr<sim::Switch> device;
+    std::vector<std::shared_ptr<sim::Switch>> neighbours;
+    std::vector<std::shared_ptr<sim::Link>> links;
+};
+
+static const std::size_t FLOWS_COUNT = 1024;
+
+// Lookup through weak pointers and shared_ptr result, as before freeze
+static void BM_RoutingGenericLookup(benchmark::State& state) {
+    EcmpSwitch ecmp_switch(state.range(0));
+    const std::vector<sim::Packet> packets = create_packets(FLOWS_COUNT);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ecmp_switch.device->get_link_to_destination(
+            packets[i++ % FLOWS_COUNT]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RoutingGenericLookup)
+    ->ArgName("ports")
+    ->RangeMultiplier(2)
+    ->Range(2, 64);
+
+// Lookup in frozen routing table used on packet processing path
+static void BM_RoutingFrozenLookup(benchmark::State& state) {
+    EcmpSwitch ecmp_switch(state.range(0));
+    ecmp_switch.device->freeze();
+    const std::vector<sim::Packet> packets = create_packets(FLOWS_COUNT);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            ecmp_switch.device->get_link_ptr_to_destination(
+                packets[i++ % FLOWS_COUNT]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RoutingFrozenLookup)
+    ->ArgName("ports")
+    ->RangeMultiplier(2)
+    ->Range(2, 64);
+
+// Routing table of one host in fat tree of range(0)-port switches
+static void BM_BfsFatTree(benchmark::State& state) {
+    FatTree tree = create_fat_tree(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sim::bfs(tree.hosts.front()));
+    }
+    state.counters["devices"] =
+        static_cast<double>(tree.hosts.size() + tree.switches.size());
+}
+BENCHMARK(BM_BfsFatTree)
+    ->ArgName("k")
+    ->DenseRange(4, 16, 4)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace bench
@@ -0,0 +1,57 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "scheduler.hpp"
+#include "utils.hpp"
+
+namespace bench {
+
+class EmptyEvent : public sim::Event {
+public:
+    explicit EmptyEvent(TimeNs a_time) : sim::Event(a_time) {}
+    void operator()() final {}
+};
+
+// Fills scheduler with range(0) events and then drains it
+static void BM_SchedulerAddThenTick(benchmark::State& state) {
+    const std::size_t events_count = state.range(0);
+    auto& scheduler = sim::Scheduler::get_instance();
+    std::mt19937_64 generator(RANDOM_SEED);
+    std::uniform_int_distribution<std::uint64_t> time(0, 1'000'000);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < events_count; i++) {
+            scheduler.add<EmptyEvent>(TimeNs(time(generator)));
+        }
+        while (scheduler.tick()) {
+        }
+        state.PauseTiming();
+        scheduler.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * events_count);
+}
+BENCHMARK(BM_SchedulerAddThenTick)->ArgName("events")->Range(1 << 10, 1 << 18);
+
+// Classic hold model: queue keeps range(0) events, every iteration processes
+// the earliest one and adds new one in the future
+static void BM_SchedulerHold(benchmark::State& state) {
+    const std::size_t queue_size = state.range(0);
+    auto& scheduler = sim::Scheduler::get_instance();
+    scheduler.clear();
+    std::mt19937_64 generator(RANDOM_SEED);
+    std::uniform_int_distribution<std::uint64_t> delay(1, 1'000'000);
+    for (std::size_t i = 0; i < queue_size; i++) {
+        scheduler.add<EmptyEvent>(TimeNs(delay(generator)));
+    }
+    for (auto _ : state) {
+        scheduler.tick();
+        scheduler.add<EmptyEvent>(scheduler.get_current_time() +
+                                  TimeNs(delay(generator)));
+    }
+    scheduler.clear();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SchedulerHold)->ArgName("queue_size")->Range(1 << 4, 1 << 20);
+
+}  // namespace bench
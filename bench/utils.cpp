@@ -0,0 +1,72 @@
+#include "utils.hpp"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <string>
+
+#include "utils/hash.hpp"
+
+namespace bench {
+
+std::vector<sim::Packet> create_packets(std::size_t flows_count,
+                                        const Id& dest_id) {
+    std::vector<sim::Packet> packets;
+    packets.reserve(flows_count);
+    for (std::size_t i = 0; i < flows_count; i++) {
+        sim::Packet packet(SizeByte(1500), nullptr,
+                           "sender" + std::to_string(i % 64), dest_id);
+        packet.flow_hash = utils::hash_string("flow" + std::to_string(i));
+        packets.push_back(std::move(packet));
+    }
+    return packets;
+}
+
+static void connect(FatTree& tree, const std::shared_ptr<sim::IDevice>& first,
+                    const std::shared_ptr<sim::IDevice>& second) {
+    for (auto [from, to] :
+         {std::pair(first, second), std::pair(second, first)}) {
+        auto link = std::make_shared<sim::Link>(
+            from->get_id() + "->" + to->get_id(), from, to);
+        from->add_outlink(link);
+        to->add_inlink(link);
+        tree.links.push_back(std::move(link));
+    }
+}
+
+FatTree create_fat_tree(std::size_t k) {
+    FatTree tree;
+    const std::size_t half = k / 2;
+    auto add_switch = [&tree](std::string id) {
+        tree.switches.push_back(std::make_shared<sim::Switch>(std::move(id)));
+        return tree.switches.back();
+    };
+
+    std::vector<std::shared_ptr<sim::Switch>> cores;
+    for (std::size_t i = 0; i < half * half; i++) {
+        cores.push_back(add_switch("core" + std::to_string(i)));
+    }
+    for (std::size_t pod = 0; pod < k; pod++) {
+        std::vector<std::shared_ptr<sim::Switch>> aggregations;
+        for (std::size_t i = 0; i < half; i++) {
+            auto aggregation = add_switch(fmt::format("agg{}_{}", pod, i));
+            for (std::size_t j = 0; j < half; j++) {
+                connect(tree, aggregation, cores[i * half + j]);
+            }
+            aggregations.push_back(std::move(aggregation));
+        }
+        for (std::size_t i = 0; i < half; i++) {
+            auto edge = add_switch(fmt::format("edge{}_{}", pod, i));
+            for (const auto& aggregation : aggregations) {
+                connect(tree, edge, aggregation);
+            }
+            for (std::size_t j = 0; j < half; j++) {
+                tree.hosts.push_back(std::make_shared<sim::Host>(
+                    fmt::format("host{}_{}_{}", pod, i, j)));
+                connect(tree, edge, tree.hosts.back());
+            }
+        }
+    }
+    return tree;
+}
+
+}  // namespace bench
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "device/host.hpp"
+#include "device/switch.hpp"
+#include "link/link.hpp"
+#include "packet.hpp"
+
+namespace bench {
+
+const unsigned RANDOM_SEED = 42;
+
+// Packets of flows_count different flows between hosts of the same ids, so
+// hashers and routing see realistic spread of header hashes
+std::vector<sim::Packet> create_packets(std::size_t flows_count,
+                                        const Id& dest_id = "receiver");
+
+struct FatTree {
+    std::vector<std::shared_ptr<sim::Host>> hosts;
+    std::vector<std::shared_ptr<sim::Switch>> switches;
+    std::vector<std::shared_ptr<sim::Link>> links;
+};
+
+// Three-level fat tree of k-port switches: k pods of k/2 edge and k/2
+// aggregation switches, (k/2)^2 core switches and k^3/4 hosts; every cable is
+// a pair of links
+FatTree create_fat_tree(std::size_t k);
+
+}  // namespace bench
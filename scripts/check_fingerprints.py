@@ -0,0 +1,113 @@
+import sys
+import os
+import re
+import json
+import subprocess
+import argparse
+import tempfile
+
+# Runs simulator on every config of directory with --fingerprint flag and
+# compares printed fingerprints with golden values. Mismatch means that
+# simulation behaviour has changed: if it is intended, golden values should be
+# updated (--update) in the same commit.
+# Every config is run by separate process, so global state (scheduler,
+# identifier factory, random seed) of previous runs does not affect it
+
+FINGERPRINT_PATTERN = re.compile(r"^Fingerprint: (.*)$", re.MULTILINE)
+
+
+def run_with_fingerprint(executable: str, config_path: str, output_dir: str):
+    args = [
+        executable,
+        "-c",
+        config_path,
+        "--output-dir",
+        output_dir,
+        "--no-logs",
+        "--no-plots",
+        "--metrics-filter",
+        "$^",
+        "--fingerprint",
+    ]
+    result = subprocess.run(args, capture_output=True, text=True)
+    match = FINGERPRINT_PATTERN.search(result.stdout)
+    if result.returncode != 0 or match is None:
+        sys.exit(
+            f"Error: simulation {config_path} failed with code "
+            f"{result.returncode}\n{result.stderr}"
+        )
+    return match.group(1)
+
+
+def main(args):
+    parser = argparse.ArgumentParser()
+    parser.add_argument(
+        "-e", "--executable", help="Path to the compiled project", required=True
+    )
+    parser.add_argument(
+        "-c",
+        "--config",
+        help="Path to the directory with simulation configs",
+        default=os.path.join("configuration_examples", "simulation_examples"),
+    )
+    parser.add_argument(
+        "-g",
+        "--golden",
+        help="JSON file that maps config names to fingerprints; configs "
+        "with null value are skipped "
+        "(default: golden_fingerprints.json in configs directory)",
+    )
+    parser.add_argument(
+        "--update",
+        action="store_true",
+        help="Write computed fingerprints to golden file instead of checking",
+    )
+
+    parsed_args = parser.parse_args()
+    golden_path = parsed_args.golden or os.path.join(
+        parsed_args.config, "golden_fingerprints.json"
+    )
+    golden = {}
+    if os.path.isfile(golden_path):
+        with open(golden_path, "r") as f:
+            golden = json.load(f)
+
+    mismatches = []
+    with tempfile.TemporaryDirectory() as output_dir:
+        for config in sorted(os.listdir(parsed_args.config)):
+            if not config.endswith(".yml") and not config.endswith(".yaml"):
+                continue
+            if config in golden and golden[config] is None:
+                print(f"{config}: skipped")
+                continue
+            fingerprint = run_with_fingerprint(
+                parsed_args.executable,
+                os.path.join(parsed_args.config, config),
+                os.path.join(output_dir, config),
+            )
+            if parsed_args.update:
+                golden[config] = fingerprint
+                print(f"{config}: {fingerprint}")
+            elif config not in golden:
+                print(f"{config}: no golden value, got {fingerprint}")
+            elif golden[config] != fingerprint:
+                mismatches.append(config)
+                print(
+                    f"{config}: MISMATCH\n"
+                    f"  expected {golden[config]}\n"
+                    f"  got      {fingerprint}"
+                )
+            else:
+                print(f"{config}: ok")
+
+    if parsed_args.update:
+        with open(golden_path, "w") as f:
+            json.dump(golden, f, indent=2, sort_keys=True)
+            f.write("\n")
+        print(f"Golden fingerprints are saved to {golden_path}")
+    if mismatches:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main(sys.argv)
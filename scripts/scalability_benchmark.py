@@ -0,0 +1,277 @@
+import sys
+import os
+import json
+import subprocess
+import argparse
+
+import yaml
+
+# Runs simulator on fat-trees of increasing k with incast and all-to-all
+# workloads of increasing fan-in and collects run statistics of every run
+# (see --run-stats flag of simulator) into single table.
+# Results may be compared with stored baseline: run is marked as regression
+# if its events per second dropped or peak memory grew by more than threshold
+
+WORKLOADS = ["incast", "all_to_all"]
+
+LINK_PRESET = {
+    "latency": "100ns",
+    "throughput": "100Gbps",
+    "ingress_buffer_size": "1024000B",
+    "egress_buffer_size": "1024000B",
+}
+
+TABLE_COLUMNS = [
+    ("case", "case"),
+    ("wall, s", "run_time_s"),
+    ("simulated, ns", "simulated_time_ns"),
+    ("events", "events"),
+    ("events/s", "events_per_second"),
+    ("peak RSS, MiB", "peak_rss_mib"),
+    ("flows", "flows"),
+    ("links", "links"),
+    ("B/flow", "bytes_per_flow"),
+    ("B/link", "bytes_per_link"),
+]
+
+
+def get_hosts(k: int):
+    # Host names given by fat_tree topology generator
+    hosts_per_pod = (k // 2) ** 2
+    return [
+        f"pod{pod}_host{host}"
+        for pod in range(1, k + 1)
+        for host in range(1, hosts_per_pod + 1)
+    ]
+
+
+def get_pairs(k: int, workload: str, fan_in: int):
+    hosts = get_hosts(k)
+    fan_in = min(fan_in, len(hosts) - 1)
+    if workload == "incast":
+        # Senders are taken from the end so that most of them are in other
+        # pods than receiver
+        return [(sender, hosts[0]) for sender in hosts[-fan_in:]]
+    # Every host receives from fan_in hosts that follow it
+    return [
+        (hosts[(i + shift) % len(hosts)], receiver)
+        for i, receiver in enumerate(hosts)
+        for shift in range(1, fan_in + 1)
+    ]
+
+
+def create_config(k: int, pairs, data_size: str, packet_size: str):
+    connections = {}
+    for i, (sender, receiver) in enumerate(pairs):
+        connections[f"conn_{i}"] = {
+            "sender_id": sender,
+            "receiver_id": receiver,
+            "mplb": "round_robin",
+            "flows": {
+                "flow": {
+                    "type": "tcp",
+                    "packet_size": packet_size,
+                    "cc": {"type": "basic"},
+                }
+            },
+        }
+    config = {
+        # Topology and simulation are described by the same file
+        "topology_config_path": "",
+        "presets": {"link": {"default": LINK_PRESET}},
+        "packet-spraying": {"type": "ecmp"},
+        "generator": {"type": "fat_tree", "k": k},
+        "connections": connections,
+    }
+    if pairs:
+        config["scenario"] = [
+            {
+                "action": "send_data",
+                "when": "0ns",
+                "size": data_size,
+                "connections": ".*",
+            }
+        ]
+    return config
+
+
+def run_case(executable: str, output_dir: str, name: str, config) -> dict:
+    case_dir = os.path.join(output_dir, name)
+    os.makedirs(case_dir, exist_ok=True)
+    config_path = os.path.join(case_dir, f"{name}.yml")
+    config["topology_config_path"] = f"{name}.yml"
+    with open(config_path, "w") as f:
+        yaml.safe_dump(config, f, sort_keys=False)
+
+    args = [
+        executable,
+        "--config",
+        config_path,
+        "--output-dir",
+        case_dir,
+        "--no-logs",
+        "--no-plots",
+        "--metrics-filter",
+        "$^",
+        "--run-stats",
+    ]
+    result = subprocess.run(args, capture_output=True, text=True)
+    if result.returncode != 0:
+        sys.exit(
+            f"Error: simulation {name} failed with code {result.returncode}\n"
+            f"{result.stderr}"
+        )
+    with open(os.path.join(case_dir, "run_stats.json"), "r") as f:
+        return json.load(f)
+
+
+def format_value(value) -> str:
+    if value is None:
+        return "-"
+    if isinstance(value, float):
+        return f"{value:.3g}" if value < 1000 else f"{value:.0f}"
+    return str(value)
+
+
+def print_table(rows, regressions):
+    header = [title for title, _ in TABLE_COLUMNS] + ["status"]
+    lines = [
+        [format_value(row[key]) for _, key in TABLE_COLUMNS]
+        + ["REGRESSION" if row["case"] in regressions else "ok"]
+        for row in rows
+    ]
+    widths = [
+        max(len(line[i]) for line in [header] + lines) for i in range(len(header))
+    ]
+    for line in [header] + lines:
+        print("  ".join(value.rjust(width) for value, width in zip(line, widths)))
+
+
+def find_regressions(rows, baseline, threshold: float):
+    regressions = {}
+    for row in rows:
+        base = baseline.get(row["case"])
+        if base is None:
+            continue
+        reasons = []
+        if row["events_per_second"] < base["events_per_second"] * (1 - threshold):
+            reasons.append(
+                f"events/s {row['events_per_second']:.0f} < "
+                f"{base['events_per_second']:.0f}"
+            )
+        if row["peak_rss_bytes"] > base["peak_rss_bytes"] * (1 + threshold):
+            reasons.append(
+                f"peak RSS {row['peak_rss_bytes']} > {base['peak_rss_bytes']}"
+            )
+        if reasons:
+            regressions[row["case"]] = reasons
+    return regressions
+
+
+def main(args):
+    parser = argparse.ArgumentParser()
+    parser.add_argument(
+        "-e", "--executable", help="Path to the compiled project", required=True
+    )
+    parser.add_argument(
+        "--output-dir",
+        help="Directory for generated configs and results",
+        default="scalability",
+    )
+    parser.add_argument(
+        "--k", type=int, nargs="+", default=[4, 8, 16], help="Fat-tree sizes"
+    )
+    parser.add_argument(
+        "--fan-in", type=int, nargs="+", default=[1, 4, 16], help="Fan-in values"
+    )
+    parser.add_argument(
+        "--workloads", nargs="+", choices=WORKLOADS, default=WORKLOADS
+    )
+    parser.add_argument(
+        "--data-size", default="64000B", help="Data sent by every connection"
+    )
+    parser.add_argument("--packet-size", default="1000B")
+    parser.add_argument(
+        "--baseline", help="Results of previous run (json) to compare with"
+    )
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.1,
+        help="Allowed relative drop of events/s and growth of peak RSS",
+    )
+
+    parsed_args = parser.parse_args()
+    os.makedirs(parsed_args.output_dir, exist_ok=True)
+
+    def run_topology(k: int) -> dict:
+        return run_case(
+            parsed_args.executable,
+            parsed_args.output_dir,
+            f"fat_tree_k{k}_topology",
+            create_config(k, [], parsed_args.data_size, parsed_args.packet_size),
+        )
+
+    rows = []
+    sizes = sorted(set(parsed_args.k))
+    # Fat-tree k should be even and at least 2
+    previous_topology = run_topology(sizes[0] - 2) if sizes[0] >= 4 else None
+    for k in sizes:
+        # Memory of topology itself (devices, links and routing tables); it is
+        # subtracted from memory of runs to get memory per flow
+        topology = run_topology(k)
+        topology_rss = topology["peak_rss_bytes"]
+        # RSS includes memory that does not depend on topology (binary,
+        # allocator, logger), so memory per link is difference of two topology
+        # sizes divided by difference of their links count; it includes
+        # routing tables and devices that come with added links
+        bytes_per_link = None
+        if (
+            previous_topology is not None
+            and topology["links"] > previous_topology["links"]
+        ):
+            bytes_per_link = max(
+                topology_rss - previous_topology["peak_rss_bytes"], 0
+            ) // (topology["links"] - previous_topology["links"])
+        previous_topology = topology
+        for workload in parsed_args.workloads:
+            for fan_in in parsed_args.fan_in:
+                name = f"fat_tree_k{k}_{workload}_f{fan_in}"
+                pairs = get_pairs(k, workload, fan_in)
+                stats = run_case(
+                    parsed_args.executable,
+                    parsed_args.output_dir,
+                    name,
+                    create_config(
+                        k, pairs, parsed_args.data_size, parsed_args.packet_size
+                    ),
+                )
+                stats["case"] = name
+                stats["peak_rss_mib"] = stats["peak_rss_bytes"] / 2**20
+                stats["bytes_per_link"] = bytes_per_link
+                stats["bytes_per_flow"] = max(
+                    stats["peak_rss_bytes"] - topology_rss, 0
+                ) // max(stats["flows"], 1)
+                rows.append(stats)
+                print(f"{name}: {stats['run_time_s']:.3f}s", file=sys.stderr)
+
+    regressions = {}
+    if parsed_args.baseline:
+        with open(parsed_args.baseline, "r") as f:
+            baseline = {row["case"]: row for row in json.load(f)}
+        regressions = find_regressions(rows, baseline, parsed_args.threshold)
+
+    print_table(rows, regressions)
+    results_path = os.path.join(parsed_args.output_dir, "results.json")
+    with open(results_path, "w") as f:
+        json.dump(rows, f, indent=2)
+    print(f"Results are saved to {results_path}")
+
+    for case, reasons in regressions.items():
+        print(f"Regression in {case}: {'; '.join(reasons)}")
+    if regressions:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main(sys.argv)
@@ -1,6 +1,7 @@
 #include "connection/connection_impl.hpp"
 
-#include "event/add_data_to_connection.hpp"
+#include <algorithm>
+
 #include "logger/logger.hpp"
 #include "scheduler.hpp"
 
@@ -14,7 +15,8 @@ ConnectionImpl::ConnectionImpl(Id a_id, std::shared_ptr<IHost> a_src,
       m_dest(a_dest),
       m_mplb(std::move(a_mplb)),
       m_data_to_send(0),
-      m_total_data_added(0) {}
+      m_total_data_added(0),
+      m_completion_reported(false) {}
 
 Id ConnectionImpl::get_id() const { return m_id; }
 
@@ -43,6 +45,9 @@ bool ConnectionImpl::delete_flow(std::shared_ptr<IFlow> flow) {
 void ConnectionImpl::add_data_to_send(SizeByte data) {
     m_data_to_send += data;
     m_total_data_added += data;
+    if (data != SizeByte(0)) {
+        m_completion_reported = false;
+    }
     send_data();
 }
 
@@ -60,9 +65,30 @@ void ConnectionImpl::update(const std::shared_ptr<IFlow>& flow) {
     m_mplb->notify_packet_confirmed(flow);
     // Trigger next possible sending attempt
     send_data();
+    // Acks that arrive after completion (e.g. of spurious retransmissions)
+    // do not report it again
+    if (!m_completion_reported && m_completion_callback && is_completed()) {
+        m_completion_reported = true;
+        m_completion_callback();
+    }
+}
+
+bool ConnectionImpl::is_completed() const {
+    if (m_total_data_added == SizeByte(0) || m_data_to_send != SizeByte(0)) {
+        return false;
+    }
+    // Flow sends full packets, so it may deliver more than was added
+    return std::all_of(m_flows.begin(), m_flows.end(), [](const auto& flow) {
+        return flow->get_delivered_data_size() >=
+               flow->get_total_data_size_added_from_conn();
+    });
+}
+
+void ConnectionImpl::set_completion_callback(std::function<void()> callback) {
+    m_completion_callback = std::move(callback);
 }
 
-std::set<std::shared_ptr<IFlow>> ConnectionImpl::get_flows() const {
+FlowsSet ConnectionImpl::get_flows() const {
     return m_flows;
 }
 
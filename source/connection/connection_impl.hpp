@@ -33,7 +33,11 @@ public:
 
     void update(const std::shared_ptr<IFlow>& flow) override;
 
-    std::set<std::shared_ptr<IFlow>> get_flows() const override;
+    bool is_completed() const override;
+
+    void set_completion_callback(std::function<void()> callback) override;
+
+    FlowsSet get_flows() const override;
 
     void clear_flows() override;
 
@@ -52,7 +56,10 @@ private:
     std::shared_ptr<IMPLB> m_mplb;
     SizeByte m_data_to_send;
     SizeByte m_total_data_added;
-    std::set<std::shared_ptr<IFlow>> m_flows;
+    FlowsSet m_flows;
+    std::function<void()> m_completion_callback;
+    // Set once completion callback is called; reset when more data is added
+    bool m_completion_reported;
 };
 
 }  // namespace sim
@@ -1,9 +1,9 @@
 #pragma once
 
 #include <optional>
+#include <set>
 
 #include "device/interfaces/i_host.hpp"
-#include "utils/flag_manager.hpp"
 #include "utils/identifier_factory.hpp"
 #include "utils/statistics.hpp"
 
@@ -27,13 +27,17 @@ public:
     virtual std::optional<TimeNs> get_last_rtt() const = 0;
     virtual TimeNs get_fct() const = 0;
 
-    virtual const BaseFlagManager& get_flag_manager() const = 0;
+    // Called when packet of the flow is dropped in network
+    virtual void on_packet_lost() = 0;
+    // Returns true if some scheduled events or packets in network still refer
+    // to the flow, so it can not be destroyed yet
+    virtual bool has_pending_references() const = 0;
 
     virtual std::shared_ptr<IHost> get_sender() const = 0;
     virtual std::shared_ptr<IHost> get_receiver() const = 0;
-
-private:
-    BaseFlagManager m_man;
 };
 
+// Flows of connection ordered by ids
+using FlowsSet = std::set<std::shared_ptr<IFlow>, IdLess>;
+
 }  // namespace sim
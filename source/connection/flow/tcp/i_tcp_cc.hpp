@@ -1,10 +1,11 @@
 #pragma once
 #include "types.hpp"
+#include "utils/memory_accounting.hpp"
 
 namespace sim {
 
 // Interfacce of TCP-like congestion control (CC) module
-class ITcpCC {
+class ITcpCC : public MemoryTracked<MemorySubsystem::Flows> {
 public:
     // Callback that triggers every time ACK receives on sender
     // returns true if congestion detected; false otherwice
@@ -4,23 +4,22 @@
 #include "metrics/metrics_collector.hpp"
 #include "packet.hpp"
 #include "scheduler.hpp"
-#include "utils/avg_rtt_packet_flag.hpp"
+#include "utils/hash.hpp"
+#include "utils/memory_accounting.hpp"
 
 namespace sim {
 
-std::string TcpFlow::m_packet_type_label = "type";
-std::string TcpFlow::m_ack_ttl_label = "ack_ttl";
-FlagManager<std::string, PacketFlagsBase> TcpFlow::m_flag_manager;
-bool TcpFlow::m_is_flag_manager_initialized = false;
-
 TcpFlow::TcpFlow(Id a_id, std::shared_ptr<IConnection> a_conn,
                  std::unique_ptr<ITcpCC> a_cc, SizeByte a_packet_size,
-                 bool a_ecn_capable)
+                 bool a_ecn_capable, bool a_reordering_metric)
     : m_id(std::move(a_id)),
       m_connection(std::move(a_conn)),
       m_src(m_connection->get_sender()),
       m_dest(m_connection->get_receiver()),
       m_ecn_capable(a_ecn_capable),
+      m_flow_hash(utils::hash_string(m_id)),
+      m_src_hash(0),
+      m_dest_hash(0),
       m_cc(std::move(a_cc)),
       m_sending_started(false),
       m_init_time(0),
@@ -32,22 +31,41 @@ TcpFlow::TcpFlow(Id a_id, std::shared_ptr<IConnection> a_conn,
       m_rto_steady(false),
       m_retransmit_count(0),
       m_packets_in_flight(0),
+      m_pending_events_count(0),
+      m_packets_in_network_count(0),
       m_total_data_from_conn(0),
       m_delivered_data_size(0),
       m_sent_data_size(0),
-      m_next_packet_num(0) {
+      m_next_packet_num(0),
+      m_packet_reordering(a_reordering_metric
+                              ? std::make_optional<SimplePacketReordering>()
+                              : std::nullopt) {
     if (m_src.lock() == nullptr) {
         throw std::invalid_argument("Sender for TcpFlow is nullptr");
     }
     if (m_dest.lock() == nullptr) {
         throw std::invalid_argument("Receiver for TcpFlow is nullptr");
     }
-    initialize_flag_manager();
+    m_src_hash = utils::hash_string(m_src.lock()->get_id());
+    m_dest_hash = utils::hash_string(m_dest.lock()->get_id());
+    // Flows are created by std::make_shared, so they are counted here
+    MemoryAccounting::add(MemorySubsystem::Flows, sizeof(TcpFlow));
+}
+
+TcpFlow::~TcpFlow() {
+    MemoryAccounting::remove(MemorySubsystem::Flows, sizeof(TcpFlow));
 }
 
 void TcpFlow::update(Packet packet) {
-    PacketType type = static_cast<PacketType>(
-        m_flag_manager.get_flag(packet.flags, m_packet_type_label));
+    m_packets_in_network_count--;
+    std::optional<PacketFlagsBase> type_flag =
+        PacketTypeFlag::get(packet.flags);
+    if (!type_flag.has_value()) {
+        LOG_ERROR(fmt::format("Type of packet {} is not set; ignored",
+                              packet.to_string()));
+        return;
+    }
+    PacketType type = static_cast<PacketType>(type_flag.value());
     if (m_src.expired()) {
         LOG_ERROR(fmt::format("Sender exprired for flow {}; ignore packet {}",
                               to_string(), packet.to_string()));
@@ -116,9 +134,9 @@ void TcpFlow::send_data(SizeByte data) {
     while (data != SizeByte(0)) {
         Packet packet = generate_data_packet(m_next_packet_num++);
         TimeNs pacing_delay = m_cc->get_pacing_delay();
-        Scheduler::get_instance().add<SendAtTime>(now + pacing_delay + shift,
-                                                  this->shared_from_this(),
-                                                  std::move(packet));
+        Scheduler::get_instance().add<SendAtTime>(
+            now + pacing_delay + shift, this, std::move(packet));
+        m_pending_events_count++;
         shift += packet_processing_time;
         data -= std::min(data, m_packet_size);
         m_packets_in_flight++;
@@ -168,8 +186,10 @@ TimeNs TcpFlow::get_fct() const {
     return m_last_ack_arrive_time - m_init_time;
 }
 
-const BaseFlagManager& TcpFlow::get_flag_manager() const {
-    return m_flag_manager;
+void TcpFlow::on_packet_lost() { m_packets_in_network_count--; }
+
+bool TcpFlow::has_pending_references() const {
+    return m_pending_events_count != 0 || m_packets_in_network_count != 0;
 }
 
 std::shared_ptr<IHost> TcpFlow::get_sender() const { return m_src.lock(); }
@@ -194,69 +214,56 @@ std::string TcpFlow::to_string() const {
     return oss.str();
 }
 
-void TcpFlow::initialize_flag_manager() {
-    if (!m_is_flag_manager_initialized) {
-        if (!m_flag_manager.register_flag_by_amount(m_packet_type_label,
-                                                    PacketType::ENUM_SIZE)) {
-            throw std::runtime_error("Can not registrate packet type label");
-        }
-        if (!m_flag_manager.register_flag_by_amount(m_ack_ttl_label,
-                                                    M_MAX_TTL + 1)) {
-            throw std::runtime_error("Can not registrate ack ttl label");
-        }
-        if (!register_packet_avg_rtt_flag(m_flag_manager)) {
-            throw std::runtime_error("Can not registrate packet avg rtt label");
-        }
-        m_is_flag_manager_initialized = true;
-    }
-}
-
 class TcpFlow::SendAtTime : public Event {
 public:
-    SendAtTime(TimeNs a_time, std::weak_ptr<TcpFlow> a_flow, Packet a_packet)
+    SendAtTime(TimeNs a_time, TcpFlow* a_flow, Packet a_packet)
         : Event(a_time), m_flow(a_flow), m_packet(std::move(a_packet)) {}
 
     void operator()() final {
-        if (m_flow.expired()) {
-            LOG_ERROR("Pointer to flow expired");
-            return;
-        }
-        auto flow = m_flow.lock();
-        flow->send_packet_now(std::move(m_packet));
+        m_flow->m_pending_events_count--;
+        m_flow->send_packet_now(std::move(m_packet));
+    }
+
+    std::uint64_t get_fingerprint() const final {
+        constexpr std::uint64_t kind =
+            utils::hash_string("TcpFlow::SendAtTime");
+        return utils::hash_combine(
+            utils::hash_combine(kind, m_flow->m_flow_hash),
+            m_packet.packet_num);
     }
 
 private:
-    std::weak_ptr<TcpFlow> m_flow;
+    TcpFlow* m_flow;
     Packet m_packet;
 };
 
 class TcpFlow::Timeout : public Event {
 public:
-    Timeout(TimeNs a_time, std::weak_ptr<TcpFlow> a_flow,
-            PacketNum a_packet_num)
+    Timeout(TimeNs a_time, TcpFlow* a_flow, PacketNum a_packet_num)
         : Event(a_time), m_flow(a_flow), m_packet_num(a_packet_num) {}
 
     void operator()() {
-        if (m_flow.expired()) {
-            LOG_ERROR("Pointer to flow expired");
-            return;
-        }
-        auto flow = m_flow.lock();
-
-        if (flow->m_ack_monitor.is_confirmed(m_packet_num)) {
+        m_flow->m_pending_events_count--;
+        if (m_flow->m_ack_monitor.is_confirmed(m_packet_num)) {
             return;
         }
         LOG_WARN(
             fmt::format("Timeout for packet number {} expired; looks "
                         "like packet loss",
                         m_packet_num));
-        flow->update_rto_on_timeout();
-        flow->m_cc->on_timeout();
-        flow->retransmit_packet(m_packet_num);
+        m_flow->update_rto_on_timeout();
+        m_flow->m_cc->on_timeout();
+        m_flow->retransmit_packet(m_packet_num);
+    }
+
+    std::uint64_t get_fingerprint() const final {
+        constexpr std::uint64_t kind = utils::hash_string("TcpFlow::Timeout");
+        return utils::hash_combine(
+            utils::hash_combine(kind, m_flow->m_flow_hash), m_packet_num);
     }
 
 private:
-    std::weak_ptr<TcpFlow> m_flow;
+    TcpFlow* m_flow;
     PacketNum m_packet_num;
 };
 
@@ -316,13 +323,15 @@ void TcpFlow::process_ack(Packet ack, std::size_t confirm_count) {
 
 Packet TcpFlow::generate_data_packet(PacketNum packet_num) {
     Packet packet;
-    m_flag_manager.set_flag(packet.flags, m_packet_type_label,
-                            PacketType::DATA);
+    PacketTypeFlag::set(packet.flags, PacketType::DATA);
     set_avg_rtt_if_present(packet);
     packet.size = m_packet_size;
     packet.flow = this;
     packet.source_id = get_sender()->get_id();
     packet.dest_id = get_receiver()->get_id();
+    packet.flow_hash = m_flow_hash;
+    packet.source_hash = m_src_hash;
+    packet.dest_hash = m_dest_hash;
     packet.packet_num = packet_num;
     packet.delivered_data_size_at_origin = m_delivered_data_size;
     packet.generated_time = Scheduler::get_instance().get_current_time();
@@ -334,7 +343,7 @@ Packet TcpFlow::generate_data_packet(PacketNum packet_num) {
 void TcpFlow::set_avg_rtt_if_present(Packet& packet) {
     std::optional<TimeNs> avg_rtt = m_rtt_statistics.get_mean();
     if (avg_rtt.has_value()) {
-        set_avg_rtt_flag(m_flag_manager, packet.flags, avg_rtt.value());
+        set_avg_rtt_flag(packet.flags, avg_rtt.value());
     }
 }
 
@@ -362,12 +371,13 @@ void TcpFlow::send_packet_now(Packet packet) {
             m_id, current_time, current_time - m_last_send_time.value());
     }
     m_last_send_time = current_time;
-    Scheduler::get_instance().add<Timeout>(current_time + m_current_rto,
-                                           this->shared_from_this(),
+    Scheduler::get_instance().add<Timeout>(current_time + m_current_rto, this,
                                            packet.packet_num);
+    m_pending_events_count++;
     m_sent_data_size += packet.size;
 
     packet.sent_time = current_time;
+    m_packets_in_network_count++;
     m_src.lock()->enqueue_packet(std::move(packet));
 }
 
@@ -378,10 +388,12 @@ void TcpFlow::retransmit_packet(PacketNum packet_num) {
 }
 
 void TcpFlow::process_data_packet(Packet packet) {
-    TimeNs current_time = Scheduler::get_instance().get_current_time();
-    m_packet_reordering.add_record(packet.packet_num);
-    MetricsCollector::get_instance().add_packet_reordering(
-        m_id, current_time, m_packet_reordering.value());
+    if (m_packet_reordering.has_value()) {
+        TimeNs current_time = Scheduler::get_instance().get_current_time();
+        m_packet_reordering->add_record(packet.packet_num);
+        MetricsCollector::get_instance().add_packet_reordering(
+            m_id, current_time, m_packet_reordering->value());
+    }
     if (M_COLLECTIVE_ACK_SUPPORT) {
         // we do not need to use m_data_packets_monitor if collective ACKs are
         // not used
@@ -389,6 +401,7 @@ void TcpFlow::process_data_packet(Packet packet) {
     }
     Packet ack = create_ack(std::move(packet));
 
+    m_packets_in_network_count++;
     m_dest.lock()->enqueue_packet(ack);
 }
 
@@ -401,6 +414,9 @@ Packet TcpFlow::create_ack(Packet data) {
     ack.dest_id = m_src.lock()->get_id();
     ack.size = SizeByte(1);
     ack.flow = this;
+    ack.flow_hash = m_flow_hash;
+    ack.source_hash = m_dest_hash;
+    ack.dest_hash = m_src_hash;
     ack.generated_time = data.generated_time;
     ack.sent_time = data.sent_time;
     ack.delivered_data_size_at_origin = data.delivered_data_size_at_origin;
@@ -408,15 +424,19 @@ Packet TcpFlow::create_ack(Packet data) {
     ack.ecn_capable_transport = data.ecn_capable_transport;
     ack.congestion_experienced = data.congestion_experienced;
 
-    m_flag_manager.set_flag(
-        ack.flags, m_packet_type_label,
-        (M_COLLECTIVE_ACK_SUPPORT ? PacketType::COLLECTIVE_ACK
-                                  : PacketType::ACK));
-    m_flag_manager.set_flag(ack.flags, m_ack_ttl_label, data.ttl);
-    try {
-        TimeNs rtt = get_avg_rtt_label(m_flag_manager, data.flags);
-        set_avg_rtt_flag(m_flag_manager, ack.flags, rtt);
-    } catch (const FlagNotSetException& e) {
+    PacketTypeFlag::set(ack.flags, (M_COLLECTIVE_ACK_SUPPORT
+                                        ? PacketType::COLLECTIVE_ACK
+                                        : PacketType::ACK));
+    if (!AckTtlFlag::set(ack.flags, data.ttl)) {
+        LOG_WARN(fmt::format("TTL {} of data packet {} does not fit into "
+                             "ack flag; clamped to {}",
+                             data.ttl, data.to_string(), M_MAX_TTL));
+        AckTtlFlag::set(ack.flags, M_MAX_TTL);
+    }
+    if (std::optional<TimeNs> rtt = get_avg_rtt_flag(data.flags);
+        rtt.has_value()) {
+        set_avg_rtt_flag(ack.flags, rtt.value());
+    } else {
         LOG_INFO(
             fmt::format("avg rtt flag does not set in data packet {} so it "
                         "will not be set in "
@@ -8,7 +8,7 @@
 #include "i_tcp_cc.hpp"
 #include "metrics/packet_reordering/simple_packet_reordering.hpp"
 #include "packet.hpp"
-#include "utils/flag_manager.hpp"
+#include "utils/avg_rtt_packet_flag.hpp"
 #include "utils/packet_num_monitor.hpp"
 #include "utils/str_expected.hpp"
 
@@ -18,7 +18,8 @@ class TcpFlow : public IFlow, public std::enable_shared_from_this<TcpFlow> {
 public:
     TcpFlow(Id a_id, std::shared_ptr<IConnection> a_conn,
             std::unique_ptr<ITcpCC> a_cc, SizeByte a_packet_size,
-            bool a_ecn_capable = true);
+            bool a_ecn_capable = true, bool a_reordering_metric = true);
+    ~TcpFlow();
     void update(Packet packet) final;
     void send_data(SizeByte data) final;
 
@@ -35,7 +36,8 @@ public:
     // to last update call
     TimeNs get_fct() const final;
 
-    const BaseFlagManager& get_flag_manager() const final;
+    void on_packet_lost() final;
+    bool has_pending_references() const final;
 
     std::shared_ptr<IHost> get_sender() const final;
     std::shared_ptr<IHost> get_receiver() const final;
@@ -46,17 +48,17 @@ public:
 private:
     // common part
     static constexpr bool M_COLLECTIVE_ACK_SUPPORT = false;
-    static void initialize_flag_manager();
 
-    static std::string m_packet_type_label;
     enum PacketType { ACK, COLLECTIVE_ACK, DATA, ENUM_SIZE };
-
-    static std::string m_ack_ttl_label;
-
-    static bool m_is_flag_manager_initialized;
-    static FlagManager<std::string, PacketFlagsBase> m_flag_manager;
     const static inline TTL M_MAX_TTL = 31;
 
+    // Layout of TCP specific packet flags
+    using PacketTypeFlag =
+        NextFlagField<AvgRttFlag,
+                      required_bits_for_values(PacketType::ENUM_SIZE)>;
+    using AckTtlFlag =
+        NextFlagField<PacketTypeFlag, required_bits_for_values(M_MAX_TTL + 1)>;
+
     Id m_id;
     std::shared_ptr<IConnection> m_connection;
 
@@ -64,6 +66,12 @@ private:
     std::weak_ptr<IHost> m_dest;
     bool m_ecn_capable;
 
+    // Header hashes are the same for all flow packets, so they are calculated
+    // once in constructor
+    HeaderHash m_flow_hash;
+    HeaderHash m_src_hash;
+    HeaderHash m_dest_hash;
+
 private:
     // sender part
     class SendAtTime;
@@ -99,6 +107,10 @@ private:
     std::uint32_t m_retransmit_count;
 
     std::uint32_t m_packets_in_flight;
+    // Count of scheduled SendAtTime and Timeout events
+    std::uint32_t m_pending_events_count;
+    // Count of data packets and ACKs that are neither delivered nor lost
+    std::uint32_t m_packets_in_network_count;
     SizeByte m_total_data_from_conn;
     SizeByte m_delivered_data_size;
     SizeByte m_sent_data_size;
@@ -107,7 +119,8 @@ private:
     // Contains numbers of all delivered acks
     PacketNumMonitor m_ack_monitor;
 
-    SimplePacketReordering m_packet_reordering;
+    // std::nullopt if reordering metric is disabled for the flow
+    std::optional<SimplePacketReordering> m_packet_reordering;
     utils::Statistics<TimeNs> m_rtt_statistics;
 
 private:
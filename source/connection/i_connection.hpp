@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 
 #include "connection/flow/i_flow.hpp"
@@ -27,7 +28,12 @@ public:
     virtual SizeByte get_total_data_added() const = 0;
     // Called by a flow when an ACK is received to update connection state
     virtual void update(const std::shared_ptr<IFlow>& flow) = 0;
-    virtual std::set<std::shared_ptr<IFlow>> get_flows() const = 0;
+    // Returns true if some data was added and all of it is delivered
+    virtual bool is_completed() const = 0;
+    // Callback is called once every time connection becomes completed (i.e.
+    // again only after more data is added)
+    virtual void set_completion_callback(std::function<void()> callback) = 0;
+    virtual FlowsSet get_flows() const = 0;
     virtual void clear_flows() = 0;
     virtual std::shared_ptr<IHost> get_sender() const = 0;
     virtual std::shared_ptr<IHost> get_receiver() const = 0;
@@ -23,7 +23,7 @@ public:
 
 private:
     using FlowPtr = std::shared_ptr<IFlow>;
-    using FlowSet = std::set<FlowPtr, std::owner_less<FlowPtr>>;
+    using FlowSet = std::set<FlowPtr, IdLess>;
 
     FlowSet m_flows;
     LoopIterator<FlowSet::iterator> m_current_flow;
@@ -30,12 +30,12 @@ static void soft_check_value_limits(float value, float min_value,
 }
 
 namespace sim {
-ECN::ECN(float a_min, float a_max, float a_probability)
+ECN::ECN(float a_min, float a_max, float a_probability,
+         std::uint64_t a_random_key)
     : m_min(a_min),
       m_max(a_max),
       m_probability(a_probability),
-      m_distribution(0.0, 1.0),
-      m_generator(std::random_device()()) {
+      m_random(a_random_key) {
     if (m_min > m_max) {
         throw std::invalid_argument("Min threshold more than max threshold");
     }
@@ -54,7 +54,7 @@ bool ECN::get_congestion_mark(float queue_filling) const {
     }
     float interpolated_probability =
         m_probability * (queue_filling - m_min) / (m_max - m_min);
-    return m_distribution(m_generator) < interpolated_probability;
+    return m_random.next_double() < interpolated_probability;
 }
 
 std::ostream& operator<<(std::ostream& out, const ECN& ecn) {
@@ -1,13 +1,16 @@
 #pragma once
 #include <iostream>
-#include <random>
 
 #include "types.hpp"
+#include "utils/random_stream.hpp"
 namespace sim {
 
 class ECN {
 public:
-    ECN(float a_min, float a_max, float a_probability);
+    // Random marks are drawn from stream given by a_random_key (e.g. hash of
+    // switch id)
+    ECN(float a_min, float a_max, float a_probability,
+        std::uint64_t a_random_key = 0);
     // Returns true if congestion detected for a given queue filling
     bool get_congestion_mark(float queue_filling) const;
 
@@ -22,8 +25,7 @@ private:
     float m_max;
     float m_probability;
 
-    mutable std::uniform_real_distribution<> m_distribution;
-    mutable std::mt19937 m_generator;
+    mutable RandomStream m_random;
 };
 
 }  // namespace sim
\ No newline at end of file
@@ -5,57 +5,37 @@
 
 namespace sim {
 
-AdaptiveFlowletHasher::AdaptiveFlowletHasher(double a_factor)
-    : m_factor(a_factor) {}
+AdaptiveFlowletHasher::AdaptiveFlowletHasher(double a_factor,
+                                             FlowletTable a_flow_table)
+    : m_factor(a_factor), m_flow_table(std::move(a_flow_table)) {}
 
 std::uint32_t AdaptiveFlowletHasher::get_hash(const Packet& packet) {
     std::uint32_t ecmp_hash = m_ecmp_hasher.get_hash(packet);
 
-    IFlow* flow = packet.flow;
-
-    if (!flow) {
-        LOG_ERROR(
-            fmt::format("Try to use AdaptiveFlowletHasher on packet {}; "
-                        "flow does not set!",
-                        packet.to_string()));
-        return ecmp_hash;
-    }
-
-    Id flow_id = flow->get_id();
-
     TimeNs curr_time = Scheduler::get_instance().get_current_time();
-    auto it = m_flow_table.find(flow_id);
-    if (it == m_flow_table.end()) {
-        m_flow_table[flow_id] = {curr_time, 0};
+    auto [entry, is_new] = m_flow_table.lookup(packet.flow_hash, curr_time);
+    if (is_new) {
         return ecmp_hash;
     }
 
-    auto& [last_seen, shift] = it->second;
-    TimeNs elapsed_from_last_seen = curr_time - last_seen;
-
-    const BaseFlagManager& flag_manager = flow->get_flag_manager();
-    try {
-        TimeNs flowlet_threshold =
-            get_avg_rtt_label(flag_manager, packet.flags) * m_factor;
-
-        if (elapsed_from_last_seen > flowlet_threshold) {
-            shift++;
-        }
-        last_seen = curr_time;
-
-        return ecmp_hash + shift;
-    } catch (FlagNotRegistratedException& e) {
-        LOG_ERROR(
-            "Adaptive flowlet hasher can not find avg rtt (packet flag not "
-            "registrated); returned previous "
-            "hash");
-        return ecmp_hash + shift;
-    } catch (FlagNotSetException& e) {
+    std::optional<TimeNs> avg_rtt = get_avg_rtt_flag(packet.flags);
+    if (!avg_rtt.has_value()) {
         LOG_WARN(
             "Adaptive flowlet hasher can not find avg rtt (packet flag not "
             "set); looks like packet from first flowlet; returned previous "
             "hash");
-        return ecmp_hash + shift;
+        return ecmp_hash + entry.shift;
     }
+
+    TimeNs elapsed_from_last_seen = curr_time - entry.last_seen;
+    TimeNs flowlet_threshold = avg_rtt.value() * m_factor;
+
+    if (elapsed_from_last_seen > flowlet_threshold) {
+        entry.shift++;
+    }
+    entry.last_seen = curr_time;
+
+    return ecmp_hash + entry.shift;
 }
+
 }  // namespace sim
\ No newline at end of file
@@ -1,13 +1,21 @@
 #pragma once
 #include "i_hasher.hpp"
+#include "utils/hash.hpp"
 
 namespace sim {
 
-class ECMPHasher : public IPacketHasher {
+// Defined in header so callers that know the exact type (routing module,
+// flowlet hashers) can inline it
+class ECMPHasher final : public IPacketHasher {
 public:
     ECMPHasher() = default;
     ~ECMPHasher() = default;
 
-    std::uint32_t get_hash(const Packet& packet) final;
+    std::uint32_t get_hash(const Packet& packet) final {
+        std::uint64_t hash =
+            utils::hash_combine(packet.flow_hash, packet.source_hash);
+        hash = utils::hash_combine(hash, packet.dest_hash);
+        return static_cast<std::uint32_t>(hash);
+    }
 };
-}  // namespace sim
\ No newline at end of file
+}  // namespace sim
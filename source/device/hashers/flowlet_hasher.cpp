@@ -1,34 +1,32 @@
 #include "flowlet_hasher.hpp"
 
-#include "get_flow_id.hpp"
 #include "scheduler.hpp"
 
 namespace sim {
 
-FLowletHasher::FLowletHasher(TimeNs a_flowlet_threshold)
-    : m_flowlet_threshold(a_flowlet_threshold) {}
+FLowletHasher::FLowletHasher(TimeNs a_flowlet_threshold,
+                             FlowletTable a_flow_table)
+    : m_flowlet_threshold(a_flowlet_threshold),
+      m_flow_table(std::move(a_flow_table)) {}
 
 std::uint32_t FLowletHasher::get_hash(const Packet& packet) {
     std::uint32_t ecmp_hash = m_ecmp_hasher.get_hash(packet);
 
-    Id flow_id = get_flow_id(packet.flow);
     TimeNs curr_time = Scheduler::get_instance().get_current_time();
-    auto it = m_flow_table.find(flow_id);
+    auto [entry, is_new] = m_flow_table.lookup(packet.flow_hash, curr_time);
 
-    if (it == m_flow_table.end()) {
-        m_flow_table[flow_id] = {curr_time, 0};
+    if (is_new) {
         return ecmp_hash;
     }
 
-    auto& [last_seen, shift] = it->second;
-    TimeNs elapsed_from_last_seen = curr_time - last_seen;
+    TimeNs elapsed_from_last_seen = curr_time - entry.last_seen;
 
     if (elapsed_from_last_seen > m_flowlet_threshold) {
-        shift++;
+        entry.shift++;
     }
-    last_seen = curr_time;
+    entry.last_seen = curr_time;
 
-    return ecmp_hash + shift;
+    return ecmp_hash + entry.shift;
 }
 
-}  // namespace sim
\ No newline at end of file
+}  // namespace sim
@@ -1,11 +1,13 @@
 #pragma once
 #include "ecmp_hasher.hpp"
+#include "flowlet_table.hpp"
 
 namespace sim {
 
 class FLowletHasher : public IPacketHasher {
 public:
-    explicit FLowletHasher(TimeNs a_flowlet_threshold);
+    explicit FLowletHasher(TimeNs a_flowlet_threshold,
+                           FlowletTable a_flow_table = FlowletTable());
     ~FLowletHasher() = default;
 
     std::uint32_t get_hash(const Packet& packet) final;
@@ -13,13 +15,10 @@ public:
 private:
     TimeNs m_flowlet_threshold;
 
-    // Maps flow ids to pair (last_time, shift)
-    // where last_time is the last time packet from given flow was catched
-    // and shift is a integer that should be addeded to ECMP hash for packets
-    // from this flow
-    std::map<Id, std::pair<TimeNs, std::uint32_t> > m_flow_table;
+    // Keeps (last_time, shift) for flows that were seen by the switch
+    FlowletTable m_flow_table;
 
     ECMPHasher m_ecmp_hasher;
 };
 
-}  // namespace sim
\ No newline at end of file
+}  // namespace sim
@@ -0,0 +1,65 @@
+#include "flowlet_table.hpp"
+
+#include "metrics/metrics_collector.hpp"
+#include "utils/hash.hpp"
+
+namespace sim {
+
+FlowletTable::FlowletTable(Id a_device_id, std::size_t a_size,
+                           std::optional<TimeNs> a_aging_time)
+    : m_device_id(std::move(a_device_id)),
+      m_size(a_size),
+      m_aging_time(a_aging_time),
+      m_entries(),
+      m_collisions_count(0),
+      m_sampled_collisions_count(0),
+      m_next_sample_time(0) {
+    if (a_size == 0) {
+        throw std::invalid_argument("Flowlet table size should be positive");
+    }
+}
+
+FlowletTable::LookupResult FlowletTable::lookup(HeaderHash flow_hash,
+                                                TimeNs now) {
+    sample_collisions(now);
+    if (m_entries.empty()) {
+        m_entries.resize(m_size);
+    }
+    Entry& entry = m_entries[utils::mix64(flow_hash) % m_size];
+    bool alive = is_alive(entry, now);
+    if (alive && entry.flow_hash == flow_hash) {
+        return {entry, false};
+    }
+    if (alive) {
+        m_collisions_count++;
+    }
+    entry = Entry{flow_hash, now, 0, true};
+    return {entry, true};
+}
+
+std::size_t FlowletTable::get_size() const { return m_size; }
+
+std::uint64_t FlowletTable::get_collisions_count() const {
+    return m_collisions_count;
+}
+
+bool FlowletTable::is_alive(const Entry& entry, TimeNs now) const {
+    if (!entry.valid) {
+        return false;
+    }
+    return !m_aging_time.has_value() ||
+           !(now - entry.last_seen > m_aging_time.value());
+}
+
+void FlowletTable::sample_collisions(TimeNs now) {
+    if (now < m_next_sample_time ||
+        m_collisions_count == m_sampled_collisions_count) {
+        return;
+    }
+    MetricsCollector::get_instance().add_flowlet_collisions(
+        m_device_id, now, m_collisions_count);
+    m_sampled_collisions_count = m_collisions_count;
+    m_next_sample_time = now + M_COLLISIONS_SAMPLE_INTERVAL;
+}
+
+}  // namespace sim
@@ -0,0 +1,69 @@
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "packet.hpp"
+
+namespace sim {
+
+// Fixed-size flowlet table indexed by flow hash, similar to ones in switch
+// ASICs: memory does not depend on number of flows, lookup is O(1) and does
+// not allocate. Entries are allocated on first lookup, so switches that see
+// no flowlet traffic do not pay for the table. Flows that map to the same slot evict each other; such
+// evictions are counted as collisions. Count of collisions is recorded to
+// metrics at most once per M_COLLISIONS_SAMPLE_INTERVAL, so their number
+// does not affect memory
+class FlowletTable {
+public:
+    struct Entry {
+        HeaderHash flow_hash = 0;
+        // Last time packet from the flow was catched
+        TimeNs last_seen = TimeNs(0);
+        // Integer that should be added to ECMP hash for packets from the flow
+        std::uint32_t shift = 0;
+        bool valid = false;
+    };
+
+    struct LookupResult {
+        Entry& entry;
+        // True if there was no actual entry for the flow, so it was created
+        bool is_new;
+    };
+
+    // About 100KB per switch
+    static constexpr std::size_t M_DEFAULT_SIZE = 4096;
+    // Much longer than flowlet thresholds (microseconds), so only finished
+    // flows are freed; without aging every new flow in a full table would
+    // evict some finished one and count as collision
+    static constexpr TimeNs M_DEFAULT_AGING_TIME = Time<Millisecond>(1);
+    static constexpr TimeNs M_COLLISIONS_SAMPLE_INTERVAL =
+        Time<Microsecond>(10);
+
+    // a_aging_time: entries that were not used for longer are treated as
+    // empty; std::nullopt means that entries do not age
+    explicit FlowletTable(
+        Id a_device_id = "", std::size_t a_size = M_DEFAULT_SIZE,
+        std::optional<TimeNs> a_aging_time = M_DEFAULT_AGING_TIME);
+
+    // Returns entry of the flow; if there is no actual entry, the slot is
+    // reinitialized with {flow_hash, now, 0}
+    LookupResult lookup(HeaderHash flow_hash, TimeNs now);
+
+    std::size_t get_size() const;
+    std::uint64_t get_collisions_count() const;
+
+private:
+    bool is_alive(const Entry& entry, TimeNs now) const;
+    void sample_collisions(TimeNs now);
+
+    Id m_device_id;
+    std::size_t m_size;
+    std::optional<TimeNs> m_aging_time;
+    std::vector<Entry> m_entries;
+    std::uint64_t m_collisions_count;
+    std::uint64_t m_sampled_collisions_count;
+    TimeNs m_next_sample_time;
+};
+
+}  // namespace sim
@@ -1,9 +1,14 @@
 #include "random_hasher.hpp"
 
+#include "utils/hash.hpp"
+
 namespace sim {
 
+RandomHasher::RandomHasher(Id a_device_id)
+    : m_random(utils::hash_string(a_device_id)) {}
+
 std::uint32_t RandomHasher::get_hash(const Packet&) {
-    return static_cast<std::uint32_t>(std::rand());
+    return static_cast<std::uint32_t>(m_random());
 }
 
 }  // namespace sim
\ No newline at end of file
@@ -1,14 +1,19 @@
 #pragma once
 #include "i_hasher.hpp"
+#include "utils/random_stream.hpp"
 
 namespace sim {
 
 class RandomHasher : public IPacketHasher {
 public:
-    RandomHasher() = default;
+    // Hashes are drawn from random stream given by device id
+    RandomHasher(Id a_device_id = "");
     ~RandomHasher() = default;
 
     std::uint32_t get_hash(const Packet& packet) final;
+
+private:
+    RandomStream m_random;
 };
 
 }  // namespace sim
\ No newline at end of file
@@ -1,19 +1,19 @@
 #include "salt_ecmp_hasher.hpp"
 
-#include "get_flow_id.hpp"
+#include "utils/hash.hpp"
 
 namespace sim {
 
 SaltECMPHasher::SaltECMPHasher(Id a_device_id)
-    : m_device_id(std::move(a_device_id)) {}
+    : m_device_id(std::move(a_device_id)),
+      m_salt(utils::hash_string(m_device_id)) {}
 
 std::uint32_t SaltECMPHasher::get_hash(const Packet& packet) {
-    std::string flow_id = get_flow_id(packet.flow);
-
-    std::hash<std::string> hasher;
-    std::string header_str = fmt::format(
-        "{} {} {} {}", flow_id, packet.source_id, packet.dest_id, m_device_id);
-    return static_cast<uint32_t>(hasher(header_str));
+    std::uint64_t hash =
+        utils::hash_combine(packet.flow_hash, packet.source_hash);
+    hash = utils::hash_combine(hash, packet.dest_hash);
+    hash = utils::hash_combine(hash, m_salt);
+    return static_cast<std::uint32_t>(hash);
 }
 
-}  // namespace sim
\ No newline at end of file
+}  // namespace sim
@@ -11,6 +11,8 @@ public:
 
 private:
     Id m_device_id;
+    // Hash of m_device_id; calculated once in constructor
+    std::uint64_t m_salt;
 };
 
 }  // namespace sim
\ No newline at end of file
@@ -10,19 +10,18 @@ namespace sim {
 Host::Host(Id a_id) : RoutingModule(a_id) {}
 
 bool Host::notify_about_arrival(TimeNs arrival_time) {
-    return m_process_scheduler.notify_about_arriving(arrival_time,
-                                                     weak_from_this());
+    return m_process_scheduler.notify_about_arriving(arrival_time, this);
 };
 
 void Host::enqueue_packet(Packet packet) {
     m_nic_buffer.push(packet);
     m_send_data_scheduler.notify_about_arriving(
-        Scheduler::get_instance().get_current_time(), weak_from_this());
+        Scheduler::get_instance().get_current_time(), this);
     LOG_INFO(fmt::format("Packet {} arrived to host", packet.to_string()));
 }
 
 TimeNs Host::process() {
-    std::shared_ptr<ILink> current_inlink = next_inlink();
+    ILink* current_inlink = next_inlink_ptr();
     TimeNs total_processing_time = TimeNs(1);
 
     if (current_inlink == nullptr) {
@@ -52,10 +51,11 @@ TimeNs Host::process() {
         LOG_WARN(
             "Packet arrived to Host that is not its destination; use routing "
             "table to send it further");
-        std::shared_ptr<ILink> next_link = get_link_to_destination(packet);
+        ILink* next_link = get_link_ptr_to_destination(packet);
 
         if (next_link == nullptr) {
             LOG_WARN("No link corresponds to destination device");
+            packet.notify_lost();
             return total_processing_time;
         }
 
@@ -63,6 +63,7 @@ TimeNs Host::process() {
             LOG_ERROR(
                 fmt::format("Packet ttl expired on device {}; packet {} lost",
                             get_id(), packet.to_string()));
+            packet.notify_lost();
             return total_processing_time;
         }
         packet.ttl--;
@@ -92,9 +93,10 @@ TimeNs Host::send_packet() {
     LOG_INFO(fmt::format("Taken new data packet on host {}. Packet: {}",
                          get_id(), data_packet.to_string()));
 
-    auto next_link = get_link_to_destination(data_packet);
+    ILink* next_link = get_link_ptr_to_destination(data_packet);
     if (next_link == nullptr) {
         LOG_WARN("Link to send data packet does not exist");
+        data_packet.notify_lost();
         return total_processing_time;
     }
 
@@ -9,9 +9,7 @@
 
 namespace sim {
 
-class Host : public IHost,
-             public RoutingModule,
-             public std::enable_shared_from_this<Host> {
+class Host : public IHost, public RoutingModule {
 public:
     Host(Id id);
     ~Host() = default;
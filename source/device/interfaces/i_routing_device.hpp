@@ -21,6 +21,10 @@ public:
         Packet packet) const = 0;
     virtual std::shared_ptr<ILink> next_inlink() = 0;
     virtual std::set<std::shared_ptr<ILink>> get_outlinks() = 0;
+
+    // Called by simulator once topology is built and will not change anymore;
+    // device may cache plain pointers to its links after it
+    virtual void freeze() = 0;
 };
 
 }  // namespace sim
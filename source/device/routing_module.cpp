@@ -1,10 +1,12 @@
 #include "device/routing_module.hpp"
 
+#include <spdlog/fmt/fmt.h>
+
 #include <algorithm>
 
-#include "hashers/ecmp_hasher.hpp"
 #include "link/i_link.hpp"
 #include "logger/logger.hpp"
+#include "utils/hash.hpp"
 #include "utils/validation.hpp"
 
 namespace sim {
@@ -26,15 +28,12 @@ bool RoutingModule::add_inlink(std::shared_ptr<ILink> link) {
             "Link destination device is incorrect (expected current device)");
         return false;
     }
-    if (m_inlinks.contains(link)) {
+    if (!m_inlinks.emplace(link->get_id(), link).second) {
         LOG_WARN("Unexpected already added inlink");
         return false;
     }
-    m_inlinks.insert(link);
-    m_next_inlink =
-        LoopIterator<std::set<std::weak_ptr<ILink>,
-                              std::owner_less<std::weak_ptr<ILink>>>::iterator>(
-            m_inlinks.begin(), m_inlinks.end());
+    m_next_inlink = LoopIterator<LinksById::iterator>(m_inlinks.begin(),
+                                                      m_inlinks.end());
     return true;
 }
 
@@ -46,11 +45,10 @@ bool RoutingModule::add_outlink(std::shared_ptr<ILink> link) {
         LOG_WARN("Outlink source is not our device");
         return false;
     }
-    if (m_outlinks.contains(link)) {
+    if (!m_outlinks.emplace(link->get_id(), link).second) {
         LOG_WARN("Unexpected already added outlink");
         return false;
     }
-    m_outlinks.insert(link);
     return true;
 }
 
@@ -70,7 +68,9 @@ bool RoutingModule::update_routing_table(Id dest_id,
     }
     auto link_dest = link->get_to();
 
-    m_routing_table[dest_id][link] += paths_count;
+    LinkWeight& link_weight = m_routing_table[dest_id][link->get_id()];
+    link_weight.link = link;
+    link_weight.weight += paths_count;
     return true;
 }
 
@@ -87,17 +87,17 @@ std::shared_ptr<ILink> RoutingModule::get_link_to_destination(
     }
 
     int total_weight = 0;
-    for (const auto& [link, weight] : link_map) {
-        total_weight += weight;
+    for (const auto& [link_id, link_weight] : link_map) {
+        total_weight += link_weight.weight;
     }
 
     int hash = m_hasher->get_hash(packet) % total_weight;
 
     int cumulative_weight = 0;
-    for (const auto& [link, weight] : link_map) {
-        cumulative_weight += weight;
+    for (const auto& [link_id, link_weight] : link_map) {
+        cumulative_weight += link_weight.weight;
         if (hash < cumulative_weight) {
-            return link.lock();
+            return link_weight.link.lock();
         }
     }
 
@@ -109,7 +109,7 @@ std::shared_ptr<ILink> RoutingModule::next_inlink() {
         LOG_INFO("Inlinks storage is empty");
         return nullptr;
     }
-    auto inlink = *m_next_inlink++;
+    auto inlink = (*m_next_inlink++).second;
     if (inlink.expired()) {
         correctify_inlinks();
         return next_inlink();
@@ -122,13 +122,94 @@ std::set<std::shared_ptr<ILink>> RoutingModule::get_outlinks() {
     std::set<std::shared_ptr<ILink>> shared_outlinks;
     std::transform(m_outlinks.begin(), m_outlinks.end(),
                    std::inserter(shared_outlinks, shared_outlinks.begin()),
-                   [](auto link) { return link.lock(); });
+                   [](const auto& link) { return link.second.lock(); });
     return shared_outlinks;
 }
 
+void RoutingModule::freeze() {
+    correctify_inlinks();
+    correctify_outlinks();
+
+    m_frozen_inlinks.clear();
+    for (const auto& [link_id, link] : m_inlinks) {
+        m_frozen_inlinks.push_back(link.lock().get());
+    }
+    // Continue round robin from the same inlink as m_next_inlink
+    m_next_frozen_inlink = 0;
+    if (!m_inlinks.empty()) {
+        ILink* next = (*m_next_inlink).second.lock().get();
+        m_next_frozen_inlink =
+            std::find(m_frozen_inlinks.begin(), m_frozen_inlinks.end(), next) -
+            m_frozen_inlinks.begin();
+    }
+
+    m_frozen_routing_table.clear();
+    for (const auto& [dest_id, link_map] : m_routing_table) {
+        FrozenRoute route{dest_id, {}, {}};
+        int cumulative_weight = 0;
+        for (const auto& [link_id, link_weight] : link_map) {
+            cumulative_weight += link_weight.weight;
+            route.links.push_back(link_weight.link.lock().get());
+            route.cumulative_weights.push_back(cumulative_weight);
+        }
+        if (route.links.empty() || cumulative_weight <= 0) {
+            continue;
+        }
+        HeaderHash dest_hash = utils::hash_string(dest_id);
+        if (!m_frozen_routing_table.emplace(dest_hash, std::move(route))
+                 .second) {
+            LOG_WARN(fmt::format(
+                "Destination id hash collision on device {}; routing table "
+                "is not frozen",
+                m_id));
+            m_frozen_routing_table.clear();
+            m_frozen_inlinks.clear();
+            return;
+        }
+    }
+    m_frozen = true;
+    m_ecmp_hasher = dynamic_cast<ECMPHasher*>(m_hasher.get());
+}
+
+ILink* RoutingModule::next_inlink_ptr() {
+    if (!m_frozen) {
+        return next_inlink().get();
+    }
+    if (m_frozen_inlinks.empty()) {
+        LOG_INFO("Inlinks storage is empty");
+        return nullptr;
+    }
+    ILink* inlink = m_frozen_inlinks[m_next_frozen_inlink];
+    if (++m_next_frozen_inlink == m_frozen_inlinks.size()) {
+        m_next_frozen_inlink = 0;
+    }
+    return inlink;
+}
+
+ILink* RoutingModule::get_link_ptr_to_destination(const Packet& packet) const {
+    if (!m_frozen) {
+        return get_link_to_destination(packet).get();
+    }
+    auto iterator = m_frozen_routing_table.find(packet.dest_hash);
+    if (iterator == m_frozen_routing_table.end() ||
+        iterator->second.dest_id != packet.dest_id) {
+        // packet hashes were not updated or destination is unknown
+        return get_link_to_destination(packet).get();
+    }
+
+    const FrozenRoute& route = iterator->second;
+    std::uint32_t packet_hash = (m_ecmp_hasher != nullptr
+                                     ? m_ecmp_hasher->get_hash(packet)
+                                     : m_hasher->get_hash(packet));
+    int hash = packet_hash % route.cumulative_weights.back();
+    auto bound = std::upper_bound(route.cumulative_weights.begin(),
+                                  route.cumulative_weights.end(), hash);
+    return route.links[bound - route.cumulative_weights.begin()];
+}
+
 void RoutingModule::correctify_inlinks() {
     std::size_t erased_count = std::erase_if(
-        m_inlinks, [](std::weak_ptr<ILink> link) { return link.expired(); });
+        m_inlinks, [](const auto& link) { return link.second.expired(); });
     if (erased_count > 0) {
         m_next_inlink = LoopIterator(m_inlinks.begin(), m_inlinks.end());
     }
@@ -136,7 +217,7 @@ void RoutingModule::correctify_inlinks() {
 
 void RoutingModule::correctify_outlinks() {
     std::erase_if(m_outlinks,
-                  [](std::weak_ptr<ILink> link) { return link.expired(); });
+                  [](const auto& link) { return link.second.expired(); });
 }
 
 }  // namespace sim
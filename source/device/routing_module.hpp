@@ -1,10 +1,13 @@
 #pragma once
 
+#include <map>
 #include <unordered_map>
+#include <vector>
 
 #include "device/interfaces/i_routing_device.hpp"
-#include "hashers/i_hasher.hpp"
+#include "hashers/ecmp_hasher.hpp"
 #include "utils/loop_iterator.hpp"
+#include "utils/memory_accounting.hpp"
 
 namespace sim {
 
@@ -23,28 +26,66 @@ public:
     std::shared_ptr<ILink> next_inlink() final;
     std::shared_ptr<ILink> get_link_to_destination(Packet packet) const final;
     std::set<std::shared_ptr<ILink>> get_outlinks() final;
+    void freeze() final;
+
+    // Same as next_inlink and get_link_to_destination, but return plain
+    // pointers; after freeze they do not touch weak_ptr reference counters.
+    // Used by devices on packet processing path
+    ILink* next_inlink_ptr();
+    ILink* get_link_ptr_to_destination(const Packet& packet) const;
 
     void correctify_inlinks();
     void correctify_outlinks();
 
 private:
+    template <typename T>
+    using RoutingAllocator =
+        TrackingAllocator<T, MemorySubsystem::RoutingTables>;
+    template <typename K, typename V>
+    using RoutingMap =
+        std::unordered_map<K, V, std::hash<K>, std::equal_to<K>,
+                           RoutingAllocator<std::pair<const K, V>>>;
+    // Links are keyed by ids, so their order (round robin over ingress
+    // buffers, choice of link by hash) does not depend on heap addresses
+    using LinksById = std::map<Id, std::weak_ptr<ILink>>;
+    struct LinkWeight {
+        std::weak_ptr<ILink> link;
+        int weight = 0;
+    };
+    using LinksWeights =
+        std::map<Id, LinkWeight, std::less<Id>,
+                 RoutingAllocator<std::pair<const Id, LinkWeight>>>;
+
     Id m_id;
     std::unique_ptr<IPacketHasher> m_hasher;
 
-    // Ordered set as we need to iterate over the ingress buffers
-    std::set<std::weak_ptr<ILink>, std::owner_less<std::weak_ptr<ILink>>>
-        m_inlinks;
+    // Ordered map as we need to iterate over the ingress buffers
+    LinksById m_inlinks;
 
-    std::set<std::weak_ptr<ILink>, std::owner_less<std::weak_ptr<ILink>>>
-        m_outlinks;
+    LinksById m_outlinks;
 
     // A routing table: maps the final destination to a specific link
-    std::unordered_map<Id, MapWeakPtr<ILink, int>> m_routing_table;
+    RoutingMap<Id, LinksWeights> m_routing_table;
 
     // Iterator for the next ingress to process
-    LoopIterator<std::set<std::weak_ptr<ILink>,
-                          std::owner_less<std::weak_ptr<ILink>>>::iterator>
-        m_next_inlink;
+    LoopIterator<LinksById::iterator> m_next_inlink;
+
+    // Links with positive cumulative weights in the same order as in
+    // m_routing_table, so frozen lookup chooses same link as usual one
+    struct FrozenRoute {
+        Id dest_id;
+        std::vector<ILink*, RoutingAllocator<ILink*>> links;
+        std::vector<int, RoutingAllocator<int>> cumulative_weights;
+    };
+
+    bool m_frozen = false;
+    // Set after freeze if device uses default hasher; called without virtual
+    // dispatch
+    ECMPHasher* m_ecmp_hasher = nullptr;
+    std::vector<ILink*> m_frozen_inlinks;
+    std::size_t m_next_frozen_inlink = 0;
+    // Keyed by destination id hash (see Packet::dest_hash)
+    RoutingMap<HeaderHash, FrozenRoute> m_frozen_routing_table;
 };
 
 }  // namespace sim
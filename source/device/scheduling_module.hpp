@@ -9,8 +9,7 @@ template <typename TDevice, typename TEvent>
 class SchedulingModule {
 public:
     // increment counter; return true if counter = 1
-    bool notify_about_arriving(TimeNs arrival_time,
-                               std::weak_ptr<TDevice> subject) {
+    bool notify_about_arriving(TimeNs arrival_time, TDevice* subject) {
         m_cnt++;
         bool result = (m_cnt == 1);
         if (result) {
@@ -36,8 +35,7 @@ public:
     };
 
 private:
-    void reschedule_event(TimeNs preferred_processing_time,
-                          std::weak_ptr<TDevice> target) {
+    void reschedule_event(TimeNs preferred_processing_time, TDevice* target) {
         m_earliest_possible_time =
             std::max(m_earliest_possible_time, preferred_processing_time);
 
@@ -3,21 +3,23 @@
 #include <iostream>
 
 #include "logger/logger.hpp"
+#include "utils/hash.hpp"
 #include "utils/validation.hpp"
 
 namespace sim {
 
 Switch::Switch(Id a_id, ECN&& a_ecn, std::unique_ptr<IPacketHasher> a_hasher)
-    : RoutingModule(a_id, std::move(a_hasher)), m_ecn(std::move(a_ecn)) {}
+    : RoutingModule(a_id, std::move(a_hasher)),
+      m_ecn(std::move(a_ecn)),
+      m_id_hash(static_cast<PathHash>(utils::hash_string(a_id))) {}
 
 bool Switch::notify_about_arrival(TimeNs arrival_time) {
-    return m_process_scheduler.notify_about_arriving(arrival_time,
-                                                     weak_from_this());
+    return m_process_scheduler.notify_about_arriving(arrival_time, this);
 };
 
 TimeNs Switch::process() {
     TimeNs total_processing_time = TimeNs(1);
-    std::shared_ptr<ILink> link = next_inlink();
+    ILink* link = next_inlink_ptr();
 
     if (link == nullptr) {
         LOG_WARN("No next inlink");
@@ -33,10 +35,11 @@ TimeNs Switch::process() {
     }
     Packet packet = optional_packet.value();
 
-    std::shared_ptr<ILink> next_link = get_link_to_destination(packet);
+    ILink* next_link = get_link_ptr_to_destination(packet);
 
     if (next_link == nullptr) {
         LOG_WARN("No link corresponds to destination device");
+        packet.notify_lost();
         return total_processing_time;
     }
 
@@ -58,10 +61,11 @@ TimeNs Switch::process() {
     if (packet.ttl == 0) {
         LOG_ERROR(fmt::format("Packet ttl expired on device {}; packet {} lost",
                               get_id(), packet.to_string()));
+        packet.notify_lost();
         return total_processing_time;
     }
     packet.ttl--;
-    packet.path_hash ^= std::hash<Id>{}(get_id());
+    packet.path_hash ^= m_id_hash;
 
     // TODO: increase total_processing_time correctly
     next_link->schedule_arrival(packet);
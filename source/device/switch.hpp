@@ -8,9 +8,7 @@
 
 namespace sim {
 
-class Switch : public ISwitch,
-               public RoutingModule,
-               public std::enable_shared_from_this<Switch> {
+class Switch : public ISwitch, public RoutingModule {
 public:
     Switch(Id a_id, ECN&& a_ecn = ECN(1.0, 1.0, 0.0),
            std::unique_ptr<IPacketHasher> a_packet_hasher = nullptr);
@@ -27,6 +25,8 @@ public:
 private:
     SchedulingModule<ISwitch, Process> m_process_scheduler;
     ECN m_ecn;
+    // Hash of switch id that is mixed into path_hash of every passed packet
+    PathHash m_id_hash;
 };
 
 }  // namespace sim
@@ -0,0 +1,24 @@
+#include "action_step.hpp"
+
+#include "utils/hash.hpp"
+
+namespace sim {
+
+ActionStep::ActionStep(TimeNs a_time, ISteppedAction* a_action,
+                       std::size_t a_stream)
+    : Event(a_time), m_action(a_action), m_stream(a_stream) {
+    m_pending_count++;
+}
+
+ActionStep::~ActionStep() { m_pending_count--; }
+
+void ActionStep::operator()() { m_action->step(m_stream); }
+
+std::uint64_t ActionStep::get_fingerprint() const {
+    constexpr std::uint64_t kind = utils::hash_string("ActionStep");
+    return utils::hash_combine(kind, m_stream);
+}
+
+std::size_t ActionStep::get_pending_count() { return m_pending_count; }
+
+}  // namespace sim
@@ -0,0 +1,28 @@
+#pragma once
+#include "event.hpp"
+#include "scenario/action/i_action.hpp"
+
+namespace sim {
+
+/**
+ * Performs next step of scenario action
+ */
+class ActionStep : public Event {
+public:
+    ActionStep(TimeNs a_time, ISteppedAction* a_action, std::size_t a_stream);
+    ~ActionStep();
+    void operator()() final;
+    std::uint64_t get_fingerprint() const final;
+
+    // Number of scheduled steps; all scenario actions are stepped, so zero
+    // means that scenario will not add data or connections anymore
+    static std::size_t get_pending_count();
+
+private:
+    static inline std::size_t m_pending_count = 0;
+
+    ISteppedAction* m_action;
+    std::size_t m_stream;
+};
+
+}  // namespace sim
@@ -13,4 +13,6 @@ bool Event::operator>(const Event &other) const {
     return m_time > other.m_time;
 }
 
+std::uint64_t Event::get_fingerprint() const { return 0; }
+
 }  // namespace sim
@@ -1,11 +1,19 @@
 #pragma once
 
+#include <cstdint>
+
 #include "types.hpp"
+#include "utils/memory_accounting.hpp"
 
 namespace sim {
 
-// Base class for event
-class Event {
+// Base class for event.
+// Events refer to devices, links and flows by plain pointers: simulator owns
+// them during the whole run, and the scheduler is drained (or cleared by Stop)
+// before they are destroyed. Only flows of transient connections are destroyed
+// earlier, when no events or packets refer to them (see
+// Simulator::add_transient_connection)
+class Event : public MemoryTracked<MemorySubsystem::Events> {
 public:
     Event(TimeNs a_time);
     virtual ~Event() = default;
@@ -14,6 +22,11 @@ public:
     TimeNs get_time() const;
     bool operator>(const Event &other) const;
 
+    // Hash of event kind and ids of objects (and packet) it refers to; used
+    // by run fingerprint (see utils/fingerprint.hpp), so it must be the same
+    // in every run and must not depend on pointers
+    virtual std::uint64_t get_fingerprint() const;
+
 protected:
     const TimeNs m_time;
 };
@@ -1,18 +1,16 @@
 #include "process.hpp"
 
 #include "scheduler.hpp"
+#include "utils/identifier_factory.hpp"
+#include "utils/hash.hpp"
 
 namespace sim {
 
-Process::Process(TimeNs a_time, std::weak_ptr<IProcessingDevice> a_device)
+Process::Process(TimeNs a_time, IProcessingDevice* a_device)
     : Event(a_time), m_device(a_device) {};
 
 void Process::operator()() {
-    if (m_device.expired()) {
-        return;
-    }
-
-    TimeNs process_time = m_device.lock()->process();
+    TimeNs process_time = m_device->process();
 
     // TODO: think about better way of cancelling event rescheduling and
     // signaling errors
@@ -23,4 +21,12 @@ void Process::operator()() {
     Scheduler::get_instance().add<Process>(m_time + process_time, m_device);
 };
 
+std::uint64_t Process::get_fingerprint() const {
+    constexpr std::uint64_t kind = utils::hash_string("Process");
+    // Processing device interface does not give id; all devices have it
+    const auto* device = dynamic_cast<const Identifiable*>(m_device);
+    return utils::hash_combine(
+        kind, (device == nullptr ? 0 : utils::hash_string(device->get_id())));
+}
+
 }  // namespace sim
\ No newline at end of file
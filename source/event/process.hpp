@@ -10,12 +10,13 @@ namespace sim {
  */
 class Process : public Event {
 public:
-    Process(TimeNs a_time, std::weak_ptr<IProcessingDevice> a_device);
+    Process(TimeNs a_time, IProcessingDevice* a_device);
     ~Process() = default;
     void operator()() final;
+    std::uint64_t get_fingerprint() const final;
 
 private:
-    std::weak_ptr<IProcessingDevice> m_device;
+    IProcessingDevice* m_device;
 };
 
 }  // namespace sim
\ No newline at end of file
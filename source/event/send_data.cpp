@@ -1,18 +1,15 @@
 #include "send_data.hpp"
 
 #include "scheduler.hpp"
+#include "utils/hash.hpp"
 
 namespace sim {
 
-SendData::SendData(TimeNs a_time, std::weak_ptr<IHost> a_device)
+SendData::SendData(TimeNs a_time, IHost* a_device)
     : Event(a_time), m_device(a_device) {};
 
 void SendData::operator()() {
-    if (m_device.expired()) {
-        return;
-    }
-
-    TimeNs process_time = m_device.lock()->send_packet();
+    TimeNs process_time = m_device->send_packet();
 
     // TODO: think about better way of cancelling event rescheduling
     if (process_time == TimeNs(0)) {
@@ -22,4 +19,9 @@ void SendData::operator()() {
     Scheduler::get_instance().add<SendData>(m_time + process_time, m_device);
 };
 
+std::uint64_t SendData::get_fingerprint() const {
+    constexpr std::uint64_t kind = utils::hash_string("SendData");
+    return utils::hash_combine(kind, utils::hash_string(m_device->get_id()));
+}
+
 }  // namespace sim
\ No newline at end of file
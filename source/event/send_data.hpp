@@ -10,12 +10,13 @@ namespace sim {
  */
 class SendData : public Event {
 public:
-    SendData(TimeNs a_time, std::weak_ptr<IHost> a_device);
+    SendData(TimeNs a_time, IHost* a_device);
     ~SendData() = default;
     void operator()() final;
+    std::uint64_t get_fingerprint() const final;
 
 private:
-    std::weak_ptr<IHost> m_device;
+    IHost* m_device;
 };
 
 }  // namespace sim
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "stop.hpp"
 
 #include "scheduler.hpp"
+#include "utils/hash.hpp"
 
 namespace sim {
 
@@ -8,4 +9,8 @@ Stop::Stop(TimeNs a_time) : Event(a_time) {}
 
 void Stop::operator()() { Scheduler::get_instance().clear(); }
 
+std::uint64_t Stop::get_fingerprint() const {
+    return utils::hash_string("Stop");
+}
+
 }  // namespace sim
\ No newline at end of file
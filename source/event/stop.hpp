@@ -11,6 +11,7 @@ public:
     Stop(TimeNs a_time);
     virtual ~Stop() = default;
     void operator()() final;
+    std::uint64_t get_fingerprint() const final;
 };
 
 }  // namespace sim
\ No newline at end of file
@@ -28,6 +28,9 @@ public:
 
     virtual SizeByte get_to_ingress_queue_size() const = 0;
     virtual SizeByte get_max_to_ingress_queue_size() const = 0;
+
+    virtual SpeedGbps get_speed() const = 0;
+    virtual TimeNs get_propagation_delay() const = 0;
 };
 
 }  // namespace sim
@@ -1,10 +1,7 @@
 #pragma once
 
-#include <queue>
-
-#include "event/event.hpp"
 #include "link/i_link.hpp"
-#include "packet_queue/link_queue.hpp"
+#include "link/link_arena.hpp"
 #include "utils/str_expected.hpp"
 
 namespace sim {
@@ -22,14 +19,17 @@ struct LinkInitArgs {
     ;
 };
 
-class Link : public ILink, public std::enable_shared_from_this<Link> {
+class Link final : public ILink {
 public:
     Link(Id a_id, std::weak_ptr<IDevice> a_from, std::weak_ptr<IDevice> a_to,
          SpeedGbps a_speed = SpeedGbps(1), TimeNs a_delay = TimeNs(0),
          SizeByte a_max_from_egress_buffer_size = SizeByte(4096),
          SizeByte a_max_to_ingress_buffer_size = SizeByte(4096));
     explicit Link(LinkInitArgs args);
-    ~Link() = default;
+    // Frees row of the link in LinkArena
+    ~Link();
+    Link(const Link&) = delete;
+    Link& operator=(const Link&) = delete;
 
     void schedule_arrival(Packet packet) final;
 
@@ -44,51 +44,19 @@ public:
     SizeByte get_to_ingress_queue_size() const final;
     SizeByte get_max_to_ingress_queue_size() const final;
 
-    Id get_id() const final;
-
-private:
-    class Transmit : public Event {
-    public:
-        Transmit(TimeNs a_time, std::weak_ptr<Link> a_link);
-        void operator()() final;
-
-    private:
-        std::weak_ptr<Link> m_link;
-    };
-
-    class Arrive : public Event {
-    public:
-        Arrive(TimeNs a_time, std::weak_ptr<Link> a_link, Packet a_packet);
-        void operator()() final;
-
-    private:
-        std::weak_ptr<Link> m_link;
-        Packet m_paket;
-    };
+    SpeedGbps get_speed() const final;
+    TimeNs get_propagation_delay() const final;
 
-    // Head packet leaves source egress queue
-    void transmit();
-
-    // Packet arrives to destination ingress queue
-    void arrive(Packet packet);
-
-    TimeNs get_transmission_delay(const Packet& packet) const;
+    Id get_id() const final;
 
-    // Schedule Transmit event
-    void start_head_packet_sending();
+    // Caches plain pointer to destination device; called by simulator when
+    // topology can not be changed anymore
+    void freeze();
 
-    Id m_id;
+private:
+    // Row of the link in LinkArena that keeps its queues, speed and delay
+    LinkArena::Index m_index;
     std::weak_ptr<IDevice> m_from;
-    std::weak_ptr<IDevice> m_to;
-    SpeedGbps m_speed;
-
-    TimeNs m_propagation_delay;
-
-    // Queue at the ingress port of the m_to device
-    LinkQueue m_from_egress;
-
-    // Queue at the egress port of the m_to device
-    LinkQueue m_to_ingress;
 };
 
 }  // namespace sim
@@ -0,0 +1,212 @@
+#include "link/link_arena.hpp"
+
+#include <bit>
+#include <cmath>
+
+#include "logger/logger.hpp"
+#include "scheduler.hpp"
+#include "utils/hash.hpp"
+
+namespace sim {
+
+LinkArena::Index LinkArena::add(Id id, std::weak_ptr<IDevice> to,
+                                SpeedGbps speed, TimeNs delay,
+                                SizeByte max_from_egress_buffer_size,
+                                SizeByte max_to_ingress_buffer_size) {
+    std::uint64_t ps_per_byte = 0;
+    if (speed != SpeedGbps(0)) {
+        double ps_per_bit =
+            PICOSECONDS_IN_NANOSECOND / speed.value_bit_per_ns();
+        ps_per_byte = std::llround(
+            std::ldexp(ps_per_bit * Byte::to_bit_multiplier,
+                       M_PS_PER_BYTE_FRACTION_BITS));
+    }
+    LinkQueue from_egress(max_from_egress_buffer_size, id,
+                          LinkQueueType::FromEgress);
+    LinkQueue to_ingress(max_to_ingress_buffer_size, id,
+                         LinkQueueType::ToIngress);
+
+    if (!m_free_rows.empty()) {
+        Index index = m_free_rows.back();
+        m_free_rows.pop_back();
+        m_ids[index] = std::move(id);
+        m_to[index] = std::move(to);
+        m_frozen_to[index] = nullptr;
+        m_speeds[index] = speed;
+        m_ps_per_byte[index] = ps_per_byte;
+        m_propagation_delays[index] = delay;
+        m_from_egress[index] = std::move(from_egress);
+        m_to_ingress[index] = std::move(to_ingress);
+        return index;
+    }
+    m_ids.push_back(std::move(id));
+    m_to.push_back(std::move(to));
+    m_frozen_to.push_back(nullptr);
+    m_speeds.push_back(speed);
+    m_ps_per_byte.push_back(ps_per_byte);
+    m_propagation_delays.push_back(delay);
+    m_from_egress.push_back(std::move(from_egress));
+    m_to_ingress.push_back(std::move(to_ingress));
+    return static_cast<Index>(m_ids.size() - 1);
+}
+
+void LinkArena::remove(Index index) {
+    // Frees packets left in queues
+    m_from_egress[index] =
+        LinkQueue(SizeByte(0), Id(), LinkQueueType::FromEgress);
+    m_to_ingress[index] =
+        LinkQueue(SizeByte(0), Id(), LinkQueueType::ToIngress);
+    m_ids[index].clear();
+    m_to[index].reset();
+    m_frozen_to[index] = nullptr;
+    m_free_rows.push_back(index);
+}
+
+void LinkArena::freeze(Index index) {
+    m_frozen_to[index] = m_to[index].lock().get();
+}
+
+void LinkArena::schedule_arrival(Index index, Packet packet) {
+    if (m_to[index].expired()) {
+        LOG_WARN("Destination device pointer is expired");
+        packet.notify_lost();
+        return;
+    }
+
+    LinkQueue& from_egress = m_from_egress[index];
+    bool empty_before_push = from_egress.empty();
+
+    if (!from_egress.push(packet)) {
+        LOG_ERROR("Egress buffer overflow; packet " + packet.to_string() +
+                  " lost");
+        packet.notify_lost();
+        return;
+    }
+
+    if (empty_before_push) {
+        start_head_packet_sending(index);
+    }
+}
+
+std::optional<Packet> LinkArena::get_packet(Index index) {
+    LinkQueue& to_ingress = m_to_ingress[index];
+    if (to_ingress.empty()) {
+        LOG_INFO("Ingress packet queue is empty");
+        return {};
+    }
+
+    Packet packet = to_ingress.front();
+    to_ingress.pop();
+    return packet;
+}
+
+const Id& LinkArena::get_id(Index index) const { return m_ids[index]; }
+
+const std::weak_ptr<IDevice>& LinkArena::get_to(Index index) const {
+    return m_to[index];
+}
+
+const LinkQueue& LinkArena::get_from_egress(Index index) const {
+    return m_from_egress[index];
+}
+
+const LinkQueue& LinkArena::get_to_ingress(Index index) const {
+    return m_to_ingress[index];
+}
+
+SpeedGbps LinkArena::get_speed(Index index) const { return m_speeds[index]; }
+
+TimeNs LinkArena::get_propagation_delay(Index index) const {
+    return m_propagation_delays[index];
+}
+
+LinkArena::Arrive::Arrive(TimeNs a_time, Index a_index, Packet a_packet)
+    : Event(a_time), m_index(a_index), m_paket(a_packet) {}
+
+void LinkArena::Arrive::operator()() {
+    LinkArena::get_instance().arrive(m_index, std::move(m_paket));
+}
+
+std::uint64_t LinkArena::Arrive::get_fingerprint() const {
+    constexpr std::uint64_t kind = utils::hash_string("Link::Arrive");
+    std::uint64_t hash = utils::hash_combine(
+        kind, utils::hash_string(LinkArena::get_instance().get_id(m_index)));
+    hash = utils::hash_combine(hash, m_paket.flow_hash);
+    return utils::hash_combine(hash, m_paket.packet_num);
+}
+
+LinkArena::Transmit::Transmit(TimeNs a_time, Index a_index)
+    : Event(a_time), m_index(a_index) {}
+
+void LinkArena::Transmit::operator()() {
+    LinkArena::get_instance().transmit(m_index);
+}
+
+std::uint64_t LinkArena::Transmit::get_fingerprint() const {
+    constexpr std::uint64_t kind = utils::hash_string("Link::Transmit");
+    return utils::hash_combine(
+        kind, utils::hash_string(LinkArena::get_instance().get_id(m_index)));
+}
+
+TimeNs LinkArena::get_transmission_delay(Index index,
+                                         const Packet& packet) const {
+    if (m_speeds[index] == SpeedGbps(0)) {
+        LOG_WARN("Passed zero link speed");
+        return TimeNs(0);
+    }
+    // Packet size is kept in bits, so it is divided by bits in byte together
+    // with fixed point shift
+    constexpr std::uint64_t bits_in_byte_log = std::countr_zero(
+        static_cast<std::uint64_t>(Byte::to_bit_multiplier));
+    constexpr std::uint32_t shift =
+        M_PS_PER_BYTE_FRACTION_BITS + bits_in_byte_log;
+    std::uint64_t delay_ps =
+        (packet.size.value_bits() * m_ps_per_byte[index] +
+         (std::uint64_t(1) << (shift - 1))) >>
+        shift;
+    return TimeNs::from_picoseconds(delay_ps);
+}
+
+void LinkArena::transmit(Index index) {
+    LinkQueue& from_egress = m_from_egress[index];
+    if (from_egress.empty()) {
+        LOG_ERROR("Transmit on link with empty source egress buffer");
+        return;
+    }
+    TimeNs current_time = Scheduler::get_instance().get_current_time();
+    Scheduler::get_instance().add<Arrive>(
+        current_time + m_propagation_delays[index], index,
+        from_egress.front());
+    from_egress.pop();
+    if (!from_egress.empty()) {
+        start_head_packet_sending(index);
+    }
+}
+
+void LinkArena::arrive(Index index, Packet packet) {
+    if (!m_to_ingress[index].push(packet)) {
+        LOG_ERROR("Ingress buffer overflow; packet " + packet.to_string() +
+                  " lost");
+        packet.notify_lost();
+        return;
+    }
+
+    TimeNs current_time = Scheduler::get_instance().get_current_time();
+    if (m_frozen_to[index] != nullptr) {
+        m_frozen_to[index]->notify_about_arrival(current_time);
+    } else {
+        m_to[index].lock()->notify_about_arrival(current_time);
+    }
+    LOG_INFO("Packet arrived to the next device. Packet: " +
+             packet.to_string());
+}
+
+void LinkArena::start_head_packet_sending(Index index) {
+    TimeNs current_time = Scheduler::get_instance().get_current_time();
+    Scheduler::get_instance().add<Transmit>(
+        current_time +
+            get_transmission_delay(index, m_from_egress[index].front()),
+        index);
+}
+
+}  // namespace sim
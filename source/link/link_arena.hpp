@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "device/interfaces/i_device.hpp"
+#include "event/event.hpp"
+#include "link/packet_queue/link_queue.hpp"
+
+namespace sim {
+
+// Hot state of all Link objects laid out as struct of arrays. Link is a
+// handle to its row and link events hold row index instead of pointer, so
+// packet forwarding touches only arrays it needs. Rows of destroyed links
+// are reused by new ones
+class LinkArena {
+public:
+    using Index = std::uint32_t;
+
+    // Never destroyed: links owned by other singletons (e.g.
+    // IdentifierFactory) may be destroyed after it otherwise
+    static LinkArena& get_instance() {
+        static LinkArena& instance = *new LinkArena();
+        return instance;
+    }
+
+    Index add(Id id, std::weak_ptr<IDevice> to, SpeedGbps speed,
+              TimeNs delay, SizeByte max_from_egress_buffer_size,
+              SizeByte max_to_ingress_buffer_size);
+    void remove(Index index);
+
+    // Caches plain pointer to destination device of the row
+    void freeze(Index index);
+
+    void schedule_arrival(Index index, Packet packet);
+    std::optional<Packet> get_packet(Index index);
+
+    const Id& get_id(Index index) const;
+    const std::weak_ptr<IDevice>& get_to(Index index) const;
+    const LinkQueue& get_from_egress(Index index) const;
+    const LinkQueue& get_to_ingress(Index index) const;
+    SpeedGbps get_speed(Index index) const;
+    TimeNs get_propagation_delay(Index index) const;
+
+private:
+    LinkArena() = default;
+    LinkArena(const LinkArena&) = delete;
+    LinkArena& operator=(const LinkArena&) = delete;
+
+    class Transmit : public Event {
+    public:
+        Transmit(TimeNs a_time, Index a_index);
+        void operator()() final;
+        std::uint64_t get_fingerprint() const final;
+
+    private:
+        Index m_index;
+    };
+
+    class Arrive : public Event {
+    public:
+        Arrive(TimeNs a_time, Index a_index, Packet a_packet);
+        void operator()() final;
+        std::uint64_t get_fingerprint() const final;
+
+    private:
+        Index m_index;
+        Packet m_paket;
+    };
+
+    // Head packet leaves source egress queue
+    void transmit(Index index);
+
+    // Packet arrives to destination ingress queue
+    void arrive(Index index, Packet packet);
+
+    TimeNs get_transmission_delay(Index index, const Packet& packet) const;
+
+    // Schedule Transmit event
+    void start_head_packet_sending(Index index);
+
+    // Transmission time of one byte in picoseconds; fixed point number with
+    // M_PS_PER_BYTE_FRACTION_BITS fractional bits, so per packet delay is
+    // computed in integers without accumulating rounding errors
+    static constexpr std::uint32_t M_PS_PER_BYTE_FRACTION_BITS = 16;
+
+    std::vector<Id> m_ids;
+    std::vector<std::weak_ptr<IDevice>> m_to;
+    // Set by freeze; nullptr before it
+    std::vector<IDevice*> m_frozen_to;
+    std::vector<SpeedGbps> m_speeds;
+    std::vector<std::uint64_t> m_ps_per_byte;
+    std::vector<TimeNs> m_propagation_delays;
+    // Queues at the egress port of source device
+    std::vector<LinkQueue> m_from_egress;
+    // Queues at the ingress port of destination device
+    std::vector<LinkQueue> m_to_ingress;
+
+    std::vector<Index> m_free_rows;
+};
+
+}  // namespace sim
@@ -2,6 +2,7 @@
 #include <queue>
 
 #include "i_packet_queue.hpp"
+#include "utils/memory_accounting.hpp"
 
 namespace sim {
 class SimplePacketQueue : public IPacketQueue {
@@ -21,7 +22,10 @@ public:
     SizeByte get_max_size() const final;
 
 private:
-    std::queue<Packet> m_queue;
+    std::queue<Packet,
+               std::deque<Packet, TrackingAllocator<
+                                      Packet, MemorySubsystem::PacketQueues>>>
+        m_queue;
     SizeByte m_size;
     SizeByte m_max_size;
 };
@@ -31,6 +31,8 @@ void Logger::disable_logs() {
     spdlog::get("multi_sink")->set_level(spdlog::level::off);
 }
 
+void Logger::flush() { spdlog::get("multi_sink")->flush(); }
+
 Logger::Logger() {
     auto console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
     console_sink->set_level(spdlog::level::warn);
@@ -15,6 +15,9 @@ public:
 
     void logExample();
     void disable_logs();
+    // Writes buffered messages; e.g. required before fork, otherwise they
+    // are written by every process
+    void flush();
     static void set_output_dir(std::string dir);
 
     void trace(std::string&& msg, const std::source_location& loc =
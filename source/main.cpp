@@ -1,11 +1,69 @@
+#include <spdlog/fmt/ranges.h>
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <chrono>
 #include <cxxopts.hpp>
+#include <fstream>
+#include <thread>
 
 #include "logger/logger.hpp"
+#include "metrics/fct_report.hpp"
 #include "metrics/metrics_collector.hpp"
+#include "parser/parse_utils.hpp"
 #include "parser/parser.hpp"
+#include "utils/filesystem.hpp"
+#include "utils/memory_accounting.hpp"
+#include "utils/random_stream.hpp"
 #include "utils/statistics.hpp"
 #include "utils/summary.hpp"
 
+using Seconds = std::chrono::duration<double>;
+
+// Statistics used to track simulator performance (see
+// scripts/scalability_benchmark.py)
+static void write_run_stats(const std::filesystem::path &path,
+                            const sim::Simulator &simulator,
+                            const sim::SummaryCsvWriter &summary_writer,
+                            Seconds setup_time, Seconds run_time) {
+    std::uint64_t events =
+        sim::Scheduler::get_instance().get_processed_events_count();
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    std::vector<std::string> memory_peaks;
+    for (std::size_t i = 0;
+         i < static_cast<std::size_t>(sim::MemorySubsystem::ENUM_SIZE); i++) {
+        auto subsystem = static_cast<sim::MemorySubsystem>(i);
+        memory_peaks.push_back(
+            fmt::format("\"{}\": {}", sim::to_string(subsystem),
+                        sim::MemoryAccounting::get_peak(subsystem)));
+    }
+
+    utils::create_all_directories(path);
+    std::ofstream out(path);
+    out << fmt::format(
+        "{{\n"
+        "  \"setup_time_s\": {},\n"
+        "  \"run_time_s\": {},\n"
+        "  \"simulated_time_ns\": {},\n"
+        "  \"events\": {},\n"
+        "  \"events_per_second\": {},\n"
+        "  \"peak_rss_bytes\": {},\n"
+        "  \"devices\": {},\n"
+        "  \"links\": {},\n"
+        "  \"connections\": {},\n"
+        "  \"flows\": {},\n"
+        "  \"memory_peak_bytes\": {{{}}}\n"
+        "}}\n",
+        setup_time.count(), run_time.count(),
+        sim::Scheduler::get_instance().get_current_time().value_nanoseconds(),
+        events, events / std::max(run_time.count(), 1e-9),
+        // ru_maxrss is in kilobytes on Linux
+        usage.ru_maxrss * 1024, simulator.get_devices().size(),
+        simulator.get_links().size(), summary_writer.get_connections_count(),
+        summary_writer.get_flows_count(), fmt::join(memory_peaks, ", "));
+}
+
 int main(const int argc, char **argv) {
     cxxopts::Options options("NoNS", "Discrete-event based simulator");
     options.add_options()("c,config",
@@ -17,9 +75,50 @@ int main(const int argc, char **argv) {
         cxxopts::value<bool>()->default_value("false"))(
         "no-plots", "Disables plots generation",
         cxxopts::value<bool>()->default_value("false"))(
+        "plot-workers",
+        "Number of processes that draw plots (default: number of cores)",
+        cxxopts::value<std::size_t>())(
+        "plot-max-points",
+        "Curves with more points are decimated keeping local minimums and "
+        "maximums (default: 2000)",
+        cxxopts::value<std::size_t>())(
         "metrics-filter", "Fiter for collecting metrics pathes",
-        cxxopts::value<std::string>()->default_value(".*"))("h,help",
-                                                            "Print usage");
+        cxxopts::value<std::string>()->default_value(".*"))(
+        "routing-cache",
+        "Directory of cached routing tables; reused for same topology",
+        cxxopts::value<std::string>())(
+        "fork-at",
+        "Simulation time at which run is forked into branches given by "
+        "--branch",
+        cxxopts::value<std::string>())(
+        "branch", "Config of branch (scenario and simulation_time)",
+        cxxopts::value<std::vector<std::string>>())(
+        "run-stats",
+        "Writes run_stats.json with run time, events count and peak memory "
+        "to output directory",
+        cxxopts::value<bool>()->default_value("false"))(
+        "memory-report-interval",
+        "Simulation time between records of memory usage by subsystems",
+        cxxopts::value<std::string>())(
+        "progress-interval",
+        "Wall-clock seconds between progress reports; they are also written "
+        "to progress.jsonl in output directory",
+        cxxopts::value<double>())(
+        "wall-time-limit",
+        "Wall-clock seconds after which simulation is stopped",
+        cxxopts::value<double>())(
+        "fct-size-bounds",
+        "Upper bounds of flow size buckets in fct_report.json, e.g. "
+        "10KB,100KB (default: 10KB,100KB,1MB,10MB)",
+        cxxopts::value<std::vector<std::string>>())(
+        "fingerprint",
+        "Prints hash of executed events and flow summaries at the end of run",
+        cxxopts::value<bool>()->default_value("false"))(
+        "seed",
+        "Seed of all random choices of simulation (ECN marks, random packet "
+        "spraying, scenario jitter and generators)",
+        cxxopts::value<std::uint64_t>()->default_value("0"))("h,help",
+                                                             "Print usage");
 
     auto flags = options.parse(argc, argv);
     auto output_dir = flags["output-dir"].as<std::string>();
@@ -34,26 +133,128 @@ int main(const int argc, char **argv) {
         Logger::get_instance().disable_logs();
     }
 
+    if (flags.contains("fork-at") && !flags.contains("branch")) {
+        std::cerr << "--fork-at requires at least one --branch" << std::endl;
+        return 1;
+    }
+
     sim::MetricsCollector::set_metrics_filter(
         flags["metrics-filter"].as<std::string>());
 
+    // Random streams take global seed when created, so it is set before
+    // parsing
+    sim::RandomStream::set_global_seed(flags["seed"].as<std::uint64_t>());
+
+    auto setup_start = std::chrono::steady_clock::now();
     sim::YamlParser parser;
     sim::Simulator simulator =
         parser.build_simulator_from_config(flags["config"].as<std::string>());
 
+    if (flags.contains("routing-cache")) {
+        simulator.set_routing_cache_dir(
+            flags["routing-cache"].as<std::string>());
+    }
+
+    if (flags.contains("memory-report-interval")) {
+        simulator.set_memory_report_interval(
+            sim::parse_time(flags["memory-report-interval"].as<std::string>())
+                .value_or_throw());
+    }
+
+    if (flags.contains("progress-interval")) {
+        simulator.set_progress_reporter(sim::ProgressReporter(
+            Seconds(flags["progress-interval"].as<double>()),
+            std::filesystem::path(output_dir) / "progress.jsonl"));
+    }
+
+    if (flags.contains("wall-time-limit")) {
+        simulator.set_wall_time_limit(
+            Seconds(flags["wall-time-limit"].as<double>()));
+    }
+
+    if (flags["fingerprint"].as<bool>()) {
+        sim::Scheduler::get_instance().enable_fingerprint();
+    }
+
+    std::vector<SizeByte> fct_size_bounds =
+        sim::FctReport::get_default_size_bounds();
+    if (flags.contains("fct-size-bounds")) {
+        fct_size_bounds.clear();
+        for (const auto &bound :
+             flags["fct-size-bounds"].as<std::vector<std::string>>()) {
+            fct_size_bounds.push_back(
+                sim::parse_size(bound).value_or_throw());
+        }
+    }
+    simulator.set_fct_report(sim::FctReport(std::move(fct_size_bounds)));
+
+    if (flags.contains("fork-at")) {
+        TimeNs fork_time = sim::parse_time(flags["fork-at"].as<std::string>())
+                               .value_or_throw();
+        std::vector<std::string> branches =
+            flags["branch"].as<std::vector<std::string>>();
+        std::optional<std::size_t> branch =
+            simulator.fork_at(fork_time, branches.size());
+        if (!branch.has_value()) {
+            // All branches are finished
+            return 0;
+        }
+        // Branch metrics are placed in separate directories; logs of all
+        // branches stay in common file
+        output_dir = (std::filesystem::path(output_dir) /
+                      fmt::format("branch_{}", branch.value()))
+                         .string();
+        sim::YamlParser::apply_branch_config(branches[branch.value()],
+                                             simulator);
+    }
+
+    // Includes connections destroyed during simulation
+    auto summary_writer = std::make_shared<sim::SummaryCsvWriter>(
+        std::filesystem::path(output_dir) / "summary.csv");
+    simulator.set_summary_writer(summary_writer);
+
+    auto run_start = std::chrono::steady_clock::now();
     simulator.start();
+    auto run_end = std::chrono::steady_clock::now();
 
     if (!flags["no-plots"].as<bool>()) {
-        sim::MetricsCollector::get_instance().draw_metric_plots(output_dir);
+        sim::PlotOptions plot_options;
+        plot_options.workers_count =
+            std::max(std::thread::hardware_concurrency(), 1u);
+        if (flags.contains("plot-workers")) {
+            plot_options.workers_count =
+                flags["plot-workers"].as<std::size_t>();
+        }
+        if (flags.contains("plot-max-points")) {
+            plot_options.max_points_per_curve =
+                flags["plot-max-points"].as<std::size_t>();
+        }
+        sim::MetricsCollector::get_instance().draw_metric_plots(output_dir,
+                                                                plot_options);
     }
     sim::MetricsCollector::get_instance().export_metrics_to_files(output_dir);
 
-    std::filesystem::path summary_path(std::filesystem::path(output_dir) /
-                                       "summary.csv");
-
-    sim::Summary summary = sim::Summary(simulator.get_connections());
+    sim::Summary summary = simulator.get_summary();
+    summary_writer->write(summary);
 
-    summary.write_to_csv(summary_path);
+    simulator.get_fct_report()->write_to_json(
+        std::filesystem::path(output_dir) / "fct_report.json");
+    if (const auto &detector = simulator.get_steady_state_detector();
+        detector.has_value()) {
+        detector->write_to_json(std::filesystem::path(output_dir) /
+                                "steady_state.json");
+    }
+    if (flags["run-stats"].as<bool>()) {
+        write_run_stats(std::filesystem::path(output_dir) / "run_stats.json",
+                        simulator, *summary_writer, run_start - setup_start,
+                        run_end - run_start);
+    }
+    if (flags["fingerprint"].as<bool>()) {
+        sim::Fingerprint fingerprint =
+            sim::Scheduler::get_instance().get_fingerprint().value();
+        fingerprint.add_summary(summary);
+        std::cout << "Fingerprint: " << fingerprint.to_string() << std::endl;
+    }
     summary.check();
 
     return 0;
@@ -0,0 +1,60 @@
+#include "decimation.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace sim {
+
+void decimate_min_max(std::vector<double>& x, std::vector<double>& y,
+                      std::size_t max_points) {
+    if (x.size() != y.size()) {
+        throw std::invalid_argument("Curve coordinates have different sizes");
+    }
+    if (x.size() <= max_points) {
+        return;
+    }
+    const std::size_t buckets_count = std::max<std::size_t>(max_points / 2, 1);
+    const double x_begin = x.front();
+    const double x_span = x.back() - x_begin;
+    auto get_bucket = [&](double value) -> std::size_t {
+        if (!(x_span > 0)) {
+            return 0;
+        }
+        return std::min(
+            buckets_count - 1,
+            static_cast<std::size_t>((value - x_begin) / x_span *
+                                     buckets_count));
+    };
+
+    // Bucket is written only after it is read, and it gives at most two
+    // points, so writes never overtake reads
+    std::size_t written = 0;
+    auto write = [&](std::size_t index) {
+        x[written] = x[index];
+        y[written] = y[index];
+        written++;
+    };
+    for (std::size_t begin = 0; begin < x.size();) {
+        std::size_t bucket = get_bucket(x[begin]);
+        std::size_t min_index = begin;
+        std::size_t max_index = begin;
+        std::size_t end = begin + 1;
+        for (; end < x.size() && get_bucket(x[end]) == bucket; end++) {
+            if (y[end] < y[min_index]) {
+                min_index = end;
+            }
+            if (y[end] > y[max_index]) {
+                max_index = end;
+            }
+        }
+        write(std::min(min_index, max_index));
+        if (min_index != max_index) {
+            write(std::max(min_index, max_index));
+        }
+        begin = end;
+    }
+    x.resize(written);
+    y.resize(written);
+}
+
+}  // namespace sim
@@ -0,0 +1,15 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+namespace sim {
+
+// Reduces curve to at most max_points points keeping its shape: x range is
+// divided into max_points / 2 equal buckets (like pixel columns of figure)
+// and only points with minimal and maximal y of every bucket are kept, in
+// their original order. Unlike uniform subsampling it keeps every peak
+// (e.g. of queue size) visible. Points should be sorted by x
+void decimate_min_max(std::vector<double>& x, std::vector<double>& y,
+                      std::size_t max_points);
+
+}  // namespace sim
@@ -1,9 +1,73 @@
 #include "draw_plots.hpp"
 
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <iostream>
+
+#include "logger/logger.hpp"
 #include "utils/safe_matplot.hpp"
 
 namespace sim {
 
+// Returns number of failed tasks
+static std::size_t run_plot_tasks_part(const std::vector<PlotTask>& tasks,
+                                       std::size_t first, std::size_t step) {
+    std::size_t failed_count = 0;
+    for (std::size_t i = first; i < tasks.size(); i += step) {
+        try {
+            tasks[i]();
+        } catch (const std::exception& e) {
+            LOG_ERROR(fmt::format("Can not draw plot: {}", e.what()));
+            failed_count++;
+        }
+    }
+    return failed_count;
+}
+
+void run_plot_tasks(const std::vector<PlotTask>& tasks,
+                    std::size_t workers_count) {
+    workers_count = std::min(workers_count, tasks.size());
+    if (workers_count <= 1) {
+        run_plot_tasks_part(tasks, 0, 1);
+        return;
+    }
+
+    // Otherwise buffered output is written by every worker
+    Logger::get_instance().flush();
+    std::cout.flush();
+
+    std::vector<pid_t> workers;
+    for (std::size_t i = 0; i < workers_count; i++) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            std::size_t failed_count =
+                run_plot_tasks_part(tasks, i, workers_count);
+            Logger::get_instance().flush();
+            // Worker has copy of the whole simulator, so it exits without
+            // destructors
+            _exit(failed_count == 0 ? 0 : 1);
+        }
+        if (pid == -1) {
+            LOG_ERROR(fmt::format(
+                "Can not fork plot worker: {}; its plots are drawn by main "
+                "process",
+                std::strerror(errno)));
+            run_plot_tasks_part(tasks, i, workers_count);
+            continue;
+        }
+        workers.push_back(pid);
+    }
+    for (pid_t worker : workers) {
+        int status = 0;
+        if (waitpid(worker, &status, 0) == -1 || !WIFEXITED(status) ||
+            WEXITSTATUS(status) != 0) {
+            LOG_ERROR(fmt::format("Plot worker {} failed", worker));
+        }
+    }
+}
+
 void draw_on_same_plot(std::filesystem::path path, PlotMetricsData data,
                        PlotMetadata metadata) {
     if (data.empty()) {
@@ -22,7 +86,7 @@ matplot::figure_handle put_on_same_plot(PlotMetricsData data,
     ax->hold(matplot::on);
 
     for (auto& [values, name] : data) {
-        values.draw_on_plot(fig, name);
+        values.draw_on_plot(fig, name, metadata.max_points_per_curve);
     }
     ax->xlabel(metadata.x_label);
     ax->ylabel(metadata.y_label);
@@ -1,12 +1,31 @@
 #pragma once
 #include <matplot/matplot.h>
 
+#include <functional>
+
 #include "metrics_storage.hpp"
 
 namespace sim {
 
 using PlotMetricsData = std::vector<std::pair<MetricsStorage, std::string> >;
 
+// Draws and saves one figure
+using PlotTask = std::function<void()>;
+
+struct PlotOptions {
+    // Longer curves are decimated (see decimate_min_max)
+    std::size_t max_points_per_curve = 2000;
+    // Number of processes that render figures
+    std::size_t workers_count = 1;
+};
+
+// Figures are independent and their rendering is dominated by gnuplot runs,
+// so tasks are distributed in round-robin between workers_count forked
+// processes. With one worker tasks run in calling process.
+// Failed tasks are logged, as missing plot does not spoil simulation results
+void run_plot_tasks(const std::vector<PlotTask>& tasks,
+                    std::size_t workers_count);
+
 // Puts data from different DataStorage on one plot
 matplot::figure_handle put_on_same_plot(PlotMetricsData data,
                                         PlotMetadata metadata);
@@ -0,0 +1,139 @@
+#include "fct_report.hpp"
+
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/fmt/ranges.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+#include "utils/filesystem.hpp"
+
+namespace sim {
+
+std::vector<SizeByte> FctReport::get_default_size_bounds() {
+    return {Size<KByte>(10), Size<KByte>(100), Size<MByte>(1),
+            Size<MByte>(10)};
+}
+
+FctReport::FctReport(std::vector<SizeByte> a_size_bounds,
+                     double a_relative_accuracy)
+    : m_relative_accuracy(a_relative_accuracy),
+      m_total{SizeByte(0), std::nullopt, QuantileSketch(a_relative_accuracy),
+              QuantileSketch(a_relative_accuracy)},
+      m_skipped_flows_count(0) {
+    std::sort(a_size_bounds.begin(), a_size_bounds.end());
+    a_size_bounds.erase(
+        std::unique(a_size_bounds.begin(), a_size_bounds.end()),
+        a_size_bounds.end());
+    SizeByte min_size(0);
+    for (SizeByte bound : a_size_bounds) {
+        if (bound == SizeByte(0)) {
+            continue;
+        }
+        m_buckets.push_back({min_size, bound,
+                             QuantileSketch(a_relative_accuracy),
+                             QuantileSketch(a_relative_accuracy)});
+        min_size = bound;
+    }
+    m_buckets.push_back({min_size, std::nullopt,
+                         QuantileSketch(a_relative_accuracy),
+                         QuantileSketch(a_relative_accuracy)});
+}
+
+void FctReport::add_flow(const FlowSummary& flow) {
+    if (flow.delivered == SizeByte(0) || flow.fct == TimeNs(0)) {
+        m_skipped_flows_count++;
+        return;
+    }
+    // First bucket whose upper bound is greater than size
+    auto it = std::find_if(m_buckets.begin(), m_buckets.end(),
+                           [&flow](const Bucket& bucket) {
+                               return !bucket.max_size.has_value() ||
+                                      flow.delivered < bucket.max_size.value();
+                           });
+    for (Bucket* bucket : {&*it, &m_total}) {
+        bucket->fct_ns.add(flow.fct.value_nanoseconds());
+        // NaN slowdowns are ignored by sketch
+        bucket->slowdown.add(flow.slowdown);
+    }
+}
+
+void FctReport::add_summary(const Summary& summary) {
+    for (const auto& [conn_id, flows] : summary.get_values()) {
+        for (const auto& [flow_id, flow] : flows) {
+            add_flow(flow);
+        }
+    }
+}
+
+const std::vector<FctReport::Bucket>& FctReport::get_buckets() const {
+    return m_buckets;
+}
+
+const FctReport::Bucket& FctReport::get_total() const { return m_total; }
+
+std::size_t FctReport::get_skipped_flows_count() const {
+    return m_skipped_flows_count;
+}
+
+// NaN is not valid JSON
+static std::string to_json_number(double value) {
+    return std::isnan(value) ? std::string("null") : fmt::format("{}", value);
+}
+
+static std::string to_json(const QuantileSketch& sketch) {
+    return fmt::format(
+        "{{\"count\": {}, \"mean\": {}, \"p50\": {}, \"p99\": {}, "
+        "\"p999\": {}, \"max\": {}}}",
+        sketch.get_count(), to_json_number(sketch.get_mean()),
+        to_json_number(sketch.get_quantile(0.5)),
+        to_json_number(sketch.get_quantile(0.99)),
+        to_json_number(sketch.get_quantile(0.999)),
+        to_json_number(sketch.get_max()));
+}
+
+static std::string to_json(const FctReport::Bucket& bucket) {
+    return fmt::format(
+        "{{\n"
+        "      \"min_size_bytes\": {},\n"
+        "      \"max_size_bytes\": {},\n"
+        "      \"fct_ns\": {},\n"
+        "      \"slowdown\": {}\n"
+        "    }}",
+        bucket.min_size.value(),
+        (bucket.max_size.has_value()
+             ? fmt::format("{}", bucket.max_size->value())
+             : std::string("null")),
+        to_json(bucket.fct_ns), to_json(bucket.slowdown));
+}
+
+void FctReport::write_to_json(const std::filesystem::path& path) const {
+    std::vector<std::string> buckets;
+    for (const Bucket& bucket : m_buckets) {
+        buckets.push_back(to_json(bucket));
+    }
+    utils::create_all_directories(path);
+    std::ofstream out(path);
+    if (!out) {
+        throw std::runtime_error("Failed to create file for FCT report");
+    }
+    out << fmt::format(
+        "{{\n"
+        "  \"relative_accuracy\": {},\n"
+        "  \"flows\": {},\n"
+        "  \"skipped_flows\": {},\n"
+        "  \"all\": {{\n"
+        "    \"fct_ns\": {},\n"
+        "    \"slowdown\": {}\n"
+        "  }},\n"
+        "  \"buckets\": [\n"
+        "    {}\n"
+        "  ]\n"
+        "}}\n",
+        m_relative_accuracy, m_total.fct_ns.get_count(), m_skipped_flows_count,
+        to_json(m_total.fct_ns), to_json(m_total.slowdown),
+        fmt::join(buckets, ",\n    "));
+}
+
+}  // namespace sim
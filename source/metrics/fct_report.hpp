@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/quantile_sketch.hpp"
+#include "utils/summary.hpp"
+
+namespace sim {
+
+// Distributions of flow completion time and slowdown (FCT divided by ideal
+// FCT) bucketed by delivered size of flow. Flows are added to streaming
+// quantile sketches one by one, so report of millions of flows takes memory
+// of a few buckets. Flows that delivered nothing are skipped; flows without
+// ideal FCT (e.g. unreachable receiver) count in FCT distribution only
+class FctReport {
+public:
+    // Upper bounds of size buckets: [0, b1), [b1, b2), ..., [bn, inf)
+    static std::vector<SizeByte> get_default_size_bounds();
+
+    explicit FctReport(
+        std::vector<SizeByte> a_size_bounds = get_default_size_bounds(),
+        double a_relative_accuracy = 0.01);
+
+    void add_flow(const FlowSummary& flow);
+    void add_summary(const Summary& summary);
+
+    struct Bucket {
+        SizeByte min_size;
+        // std::nullopt for the last bucket
+        std::optional<SizeByte> max_size;
+        QuantileSketch fct_ns;
+        QuantileSketch slowdown;
+    };
+
+    const std::vector<Bucket>& get_buckets() const;
+    // All added flows regardless of size
+    const Bucket& get_total() const;
+    std::size_t get_skipped_flows_count() const;
+
+    void write_to_json(const std::filesystem::path& path) const;
+
+private:
+    double m_relative_accuracy;
+    std::vector<Bucket> m_buckets;
+    Bucket m_total;
+    std::size_t m_skipped_flows_count;
+};
+
+}  // namespace sim
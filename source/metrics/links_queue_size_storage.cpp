@@ -42,8 +42,9 @@ void LinksQueueSizeStorage::export_to_files(
     }
 }
 
-void LinksQueueSizeStorage::draw_plots(
-    std::filesystem::path output_dir_path) const {
+std::vector<PlotTask> LinksQueueSizeStorage::get_plots_tasks(
+    std::filesystem::path output_dir_path,
+    std::size_t max_points_per_curve) const {
     // for data from both from_ingress and to_ingress queue sizes
     std::map<Id, PlotMetricsData> queue_size_data;
     for (auto& [key, values] : data()) {
@@ -52,41 +53,51 @@ void LinksQueueSizeStorage::draw_plots(
         std::replace(curve_name.begin(), curve_name.end(), '_', ' ');
         queue_size_data[link_id].emplace_back(values, curve_name);
     }
-    for (auto [link_id, data] : queue_size_data) {
-        auto link =
-            IdentifierFactory::get_instance().get_object<ILink>(link_id);
-        PlotMetadata metadata = {
-            "Time, ns", "Values, bytes",
-            fmt::format("Queue size from {} to {}", link->get_from()->get_id(),
-                        link->get_to()->get_id())};
+    std::vector<PlotTask> tasks;
+    for (auto& [link_id, data] : queue_size_data) {
+        tasks.push_back([link_id, data = std::move(data),
+                         plot_path = output_dir_path /
+                                     fmt::format("{}.svg", link_id),
+                         max_points_per_curve]() {
+            draw_plot(link_id, data, plot_path, max_points_per_curve);
+        });
+    }
+    return tasks;
+}
 
-        auto fig = put_on_same_plot(data, metadata);
-        auto ax = fig->current_axes();
+void LinksQueueSizeStorage::draw_plot(const Id& link_id,
+                                      const PlotMetricsData& data,
+                                      const std::filesystem::path& plot_path,
+                                      std::size_t max_points_per_curve) {
+    auto link = IdentifierFactory::get_instance().get_object<ILink>(link_id);
+    PlotMetadata metadata = {
+        "Time, ns", "Values, bytes",
+        fmt::format("Queue size from {} to {}", link->get_from()->get_id(),
+                    link->get_to()->get_id()),
+        max_points_per_curve};
 
-        auto limits = ax->xlim();
+    auto fig = put_on_same_plot(data, metadata);
+    auto ax = fig->current_axes();
 
-        auto draw_gorizontal_line = [&limits](
-                                        double line_y, std::string_view name,
-                                        std::initializer_list<float> color) {
-            matplot::line(0, line_y, limits[1], line_y)
-                ->line_width(1.5)
-                .color(color)
-                .display_name(name);
-        };
+    auto limits = ax->xlim();
 
-        draw_gorizontal_line(link->get_max_from_egress_buffer_size().value(),
-                             "max from egress", {1.f, 0.f, 0.f});
-        draw_gorizontal_line(link->get_max_to_ingress_queue_size().value(),
-                             "max to ingress", {0.f, 0.f, 1.f});
+    auto draw_gorizontal_line = [&limits](double line_y, std::string_view name,
+                                          std::initializer_list<float> color) {
+        matplot::line(0, line_y, limits[1], line_y)
+            ->line_width(1.5)
+            .color(color)
+            .display_name(name);
+    };
 
-        ax->xlim({0, limits[1]});
-        ax->color("white");
+    draw_gorizontal_line(link->get_max_from_egress_buffer_size().value(),
+                         "max from egress", {1.f, 0.f, 0.f});
+    draw_gorizontal_line(link->get_max_to_ingress_queue_size().value(),
+                         "max to ingress", {0.f, 0.f, 1.f});
 
-        std::filesystem::path plot_path =
-            output_dir_path / fmt::format("{}.svg", link_id);
+    ax->xlim({0, limits[1]});
+    ax->color("white");
 
-        matplot::safe_save(fig, plot_path.string());
-    }
+    matplot::safe_save(fig, plot_path.string());
 }
 
 std::map<std::pair<Id, LinkQueueType>, MetricsStorage>
@@ -5,6 +5,7 @@
 #include <regex>
 #include <utility>
 
+#include "draw_plots.hpp"
 #include "link/packet_queue/link_queue.hpp"
 #include "metrics_storage.hpp"
 #include "types.hpp"
@@ -16,13 +17,20 @@ public:
 
     void add_record(Id id, LinkQueueType type, TimeNs time, double value);
     void export_to_files(std::filesystem::path output_dir_path) const;
-    void draw_plots(std::filesystem::path output_dir_path) const;
+    // Tasks that draw plot for every link
+    std::vector<PlotTask> get_plots_tasks(
+        std::filesystem::path output_dir_path,
+        std::size_t max_points_per_curve) const;
 
     std::map<std::pair<Id, LinkQueueType>, MetricsStorage> data() const;
 
 private:
     std::string get_metrics_filename(Id id) const;
 
+    static void draw_plot(const Id& link_id, const PlotMetricsData& data,
+                          const std::filesystem::path& plot_path,
+                          std::size_t max_points_per_curve);
+
     // If m_storage does not contain some id, there was no check is metrics file
     // name for id correspond to m_filter
     // If m_storage[id] = std::nullopt, this check was failed
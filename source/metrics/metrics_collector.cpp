@@ -55,9 +55,34 @@ MetricsCollector::MetricsCollector()
         M_PACKET_SPACING_STORAGE_NAME,
         PlotMetadata{"Time, ns", "Packet spacing, ns", "Packet spacing"},
         flow_id_to_curve_name, false);
+    add_storage(M_FLOWLET_COLLISIONS_STORAGE_NAME,
+                PlotMetadata{"Time, ns", "Collisions count",
+                             "Flowlet table collisions"},
+                [](const Id& switch_id) { return switch_id; });
+    add_storage(M_MEMORY_STORAGE_NAME,
+                PlotMetadata{"Time, ns", "Memory, bytes",
+                             "Memory usage by subsystems"},
+                [](const Id& subsystem) { return subsystem; });
     m_is_initialised = true;
 }
 
+bool TimeWindow::contains(TimeNs time) const {
+    return !(from > time) && (!to.has_value() || to.value() > time);
+}
+
+void MetricsCollector::set_recording_windows(std::vector<TimeWindow> windows) {
+    m_recording_windows = std::move(windows);
+}
+
+bool MetricsCollector::is_recording(TimeNs time) const {
+    // Usually there are one or two windows, so linear search is fastest
+    return m_recording_windows.empty() ||
+           std::any_of(m_recording_windows.begin(), m_recording_windows.end(),
+                       [time](const TimeWindow& window) {
+                           return window.contains(time);
+                       });
+}
+
 MetricsCollector& MetricsCollector::get_instance() {
     static MetricsCollector instance;
     return instance;
@@ -74,39 +99,82 @@ MultiIdMetricsStorage& MetricsCollector::get_storage_named(
 }
 
 void MetricsCollector::add_cwnd(Id flow_id, TimeNs time, double cwnd) {
+    if (!is_recording(time)) {
+        return;
+    }
     get_storage_named(M_CWND_STORAGE_NAME)
         .add_record(std::move(flow_id), time, cwnd);
 }
 
 void MetricsCollector::add_delivery_rate(Id flow_id, TimeNs time,
                                          SpeedGbps value) {
+    if (!is_recording(time)) {
+        return;
+    }
     get_storage_named(M_RATE_STORAGE_NAME)
         .add_record(std::move(flow_id), time, value.value());
 }
 
 void MetricsCollector::add_RTT(Id flow_id, TimeNs time, TimeNs value) {
+    if (!is_recording(time)) {
+        return;
+    }
     get_storage_named(M_RTT_STORAGE_NAME)
         .add_record(std::move(flow_id), time, value.value());
 }
 
 void MetricsCollector::add_packet_reordering(Id flow_id, TimeNs time,
                                              PacketReordering reordering) {
+    if (!is_recording(time)) {
+        return;
+    }
     get_storage_named(M_REORDERING_STORAGE_NAME)
         .add_record(std::move(flow_id), time, reordering);
 }
 
 void MetricsCollector::add_packet_spacing(Id flow_id, TimeNs time,
                                           TimeNs value) {
+    if (!is_recording(time)) {
+        return;
+    }
     get_storage_named(M_PACKET_SPACING_STORAGE_NAME)
         .add_record(std::move(flow_id), time, value.value());
 }
 
+void MetricsCollector::remove_flow_metrics(const Id& flow_id) {
+    for (const std::string& name :
+         {M_RTT_STORAGE_NAME, M_CWND_STORAGE_NAME, M_RATE_STORAGE_NAME,
+          M_REORDERING_STORAGE_NAME, M_PACKET_SPACING_STORAGE_NAME}) {
+        get_storage_named(name).remove(flow_id);
+    }
+}
+
+void MetricsCollector::add_flowlet_collisions(Id switch_id, TimeNs time,
+                                              std::uint64_t collisions_count) {
+    if (!is_recording(time)) {
+        return;
+    }
+    get_storage_named(M_FLOWLET_COLLISIONS_STORAGE_NAME)
+        .add_record(std::move(switch_id), time, collisions_count);
+}
+
 void MetricsCollector::add_queue_size(Id link_id, TimeNs time, SizeByte value,
                                       LinkQueueType type) {
+    if (!is_recording(time)) {
+        return;
+    }
     m_links_queue_size_storage.add_record(std::move(link_id), type, time,
                                           value.value());
 }
 
+// Not limited by recording windows: memory usage is diagnostics of the
+// simulator itself
+void MetricsCollector::add_memory_usage(MemorySubsystem subsystem,
+                                        TimeNs time, SizeByte value) {
+    get_storage_named(M_MEMORY_STORAGE_NAME)
+        .add_record(to_string(subsystem), time, value.value());
+}
+
 void MetricsCollector::export_metrics_to_files(
     std::filesystem::path metrics_dir) const {
     for (const auto& [_, storage_data] : m_multi_id_storages) {
@@ -115,24 +183,33 @@ void MetricsCollector::export_metrics_to_files(
     m_links_queue_size_storage.export_to_files(metrics_dir);
 }
 
-void MetricsCollector::draw_queue_size_plots(
-    std::filesystem::path dir_path) const {
-    m_links_queue_size_storage.draw_plots(dir_path);
-}
-
-void MetricsCollector::draw_metric_plots(
-    std::filesystem::path metrics_dir) const {
+void MetricsCollector::draw_metric_plots(std::filesystem::path metrics_dir,
+                                         PlotOptions options) const {
+    std::vector<PlotTask> tasks;
     for (const auto& [storage_name, storage_data] : m_multi_id_storages) {
+        PlotMetadata metadata = storage_data.metadata;
+        metadata.max_points_per_curve = options.max_points_per_curve;
         if (storage_data.draw_on_same_plot) {
-            storage_data.storage.draw_on_plot(
-                metrics_dir / (storage_name + ".svg"), storage_data.metadata,
-                storage_data.id_to_curve_name);
+            tasks.push_back([&storage_data, metadata,
+                             path = metrics_dir / (storage_name + ".svg")]() {
+                storage_data.storage.draw_on_plot(
+                    path, metadata, storage_data.id_to_curve_name);
+            });
         } else {
-            storage_data.storage.draw_on_different_plots(
-                metrics_dir / storage_name, storage_data.metadata);
+            std::vector<PlotTask> storage_tasks =
+                storage_data.storage.get_different_plots_tasks(
+                    metrics_dir / storage_name, metadata);
+            std::move(storage_tasks.begin(), storage_tasks.end(),
+                      std::back_inserter(tasks));
         }
     }
-    draw_queue_size_plots(metrics_dir / "queue_size");
+    std::vector<PlotTask> queue_size_tasks =
+        m_links_queue_size_storage.get_plots_tasks(
+            metrics_dir / "queue_size", options.max_points_per_curve);
+    std::move(queue_size_tasks.begin(), queue_size_tasks.end(),
+              std::back_inserter(tasks));
+
+    run_plot_tasks(tasks, options.workers_count);
 }
 
 void MetricsCollector::set_metrics_filter(const std::string& filter) {
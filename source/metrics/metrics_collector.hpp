@@ -8,6 +8,7 @@
 #include "links_queue_size_storage.hpp"
 #include "multi_id_metrics_storage.hpp"
 #include "packet_reordering/i_packet_reordering.hpp"
+#include "utils/memory_accounting.hpp"
 namespace sim {
 
 struct StorageData {
@@ -17,24 +18,50 @@ struct StorageData {
     bool draw_on_same_plot;
 };
 
+// Interval [from, to) of simulation time; without `to` it lasts until the
+// end of simulation
+struct TimeWindow {
+    TimeNs from;
+    std::optional<TimeNs> to;
+
+    bool contains(TimeNs time) const;
+};
+
 class MetricsCollector {
 public:
     static MetricsCollector& get_instance();
 
+    // Metrics are recorded only inside given windows (e.g. after warm-up);
+    // empty list means whole simulation
+    void set_recording_windows(std::vector<TimeWindow> windows);
+
     // Flow metrics
     void add_cwnd(Id flow_id, TimeNs time, double cwnd);
     void add_delivery_rate(Id flow_id, TimeNs time, SpeedGbps value);
     void add_RTT(Id flow_id, TimeNs time, TimeNs value);
     void add_packet_reordering(Id flow_id, TimeNs time, PacketReordering value);
     void add_packet_spacing(Id flow_id, TimeNs time, TimeNs value);
+    // Frees metrics of flow that is destroyed during simulation (flow of
+    // transient connection), so memory does not grow with number of such
+    // flows; their final values are kept in summary
+    void remove_flow_metrics(const Id& flow_id);
+
+    // Switch metrics
+    void add_flowlet_collisions(Id switch_id, TimeNs time,
+                                std::uint64_t collisions_count);
 
     // Link metrics
     void add_queue_size(Id link_id, TimeNs time, SizeByte value,
                         LinkQueueType type = LinkQueueType::FromEgress);
 
+    // Simulator metrics
+    void add_memory_usage(MemorySubsystem subsystem, TimeNs time,
+                          SizeByte value);
+
     // Layout
     void export_metrics_to_files(std::filesystem::path metrics_dir) const;
-    void draw_metric_plots(std::filesystem::path metrics_dir) const;
+    void draw_metric_plots(std::filesystem::path metrics_dir,
+                           PlotOptions options = {}) const;
 
     static void set_metrics_filter(const std::string& filter);
 
@@ -46,7 +73,7 @@ private:
     MetricsCollector(const MetricsCollector&) = delete;
     MetricsCollector& operator=(const MetricsCollector&) = delete;
 
-    void draw_queue_size_plots(std::filesystem::path dir_path) const;
+    bool is_recording(TimeNs time) const;
 
     MultiIdMetricsStorage& get_storage_named(const std::string& name);
 
@@ -56,11 +83,17 @@ private:
     static constexpr std::string M_REORDERING_STORAGE_NAME = "reordering";
     static constexpr std::string M_PACKET_SPACING_STORAGE_NAME =
         "packet_spacing";
+    static constexpr std::string M_MEMORY_STORAGE_NAME = "memory";
+    // Does not fit into small string buffer, so can not be constexpr
+    static inline const std::string M_FLOWLET_COLLISIONS_STORAGE_NAME =
+        "flowlet_collisions";
 
     std::unordered_map<std::string, StorageData> m_multi_id_storages;
 
     // link_ID --> vector of <time, queue size> values
     LinksQueueSizeStorage m_links_queue_size_storage;
+
+    std::vector<TimeWindow> m_recording_windows;
 };
 
 }  // namespace sim
@@ -2,6 +2,7 @@
 
 #include <spdlog/fmt/fmt.h>
 
+#include "decimation.hpp"
 #include "utils/safe_matplot.hpp"
 
 namespace sim {
@@ -11,7 +12,7 @@ void MetricsStorage::add_record(TimeNs time, double value) {
 }
 
 std::vector<std::pair<TimeNs, double> > MetricsStorage::get_records() const {
-    return m_records;
+    return {m_records.begin(), m_records.end()};
 }
 
 void MetricsStorage::export_to_file(std::filesystem::path path) const {
@@ -29,7 +30,7 @@ void MetricsStorage::export_to_file(std::filesystem::path path) const {
 matplot::figure_handle MetricsStorage::get_picture(
     PlotMetadata metadata) const {
     auto fig = matplot::figure(true);
-    draw_on_plot(fig);
+    draw_on_plot(fig, "", metadata.max_points_per_curve);
 
     auto ax = fig->current_axes();
     ax->xlabel(metadata.x_label);
@@ -46,7 +47,8 @@ void MetricsStorage::draw_plot(std::filesystem::path path,
 }
 
 void MetricsStorage::draw_on_plot(matplot::figure_handle& fig,
-                                  std::string_view name) const {
+                                  std::string_view name,
+                                  std::size_t max_points) const {
     std::vector<double> x_data;
     std::transform(begin(m_records), end(m_records), std::back_inserter(x_data),
                    [](auto const& pair) { return pair.first.value(); });
@@ -55,7 +57,12 @@ void MetricsStorage::draw_on_plot(matplot::figure_handle& fig,
     std::transform(begin(m_records), end(m_records), std::back_inserter(y_data),
                    [](auto const& pair) { return pair.second; });
 
-    auto plot = fig->current_axes()->plot(x_data, y_data, "-o");
+    // Markers show measured points, so they are not drawn for decimated curve
+    bool is_decimated = x_data.size() > max_points;
+    decimate_min_max(x_data, y_data, max_points);
+
+    auto plot = fig->current_axes()->plot(x_data, y_data,
+                                          (is_decimated ? "-" : "-o"));
     plot->line_width(1.5);
     plot->display_name(name);
 }
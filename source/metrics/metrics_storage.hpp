@@ -2,9 +2,11 @@
 #include <matplot/matplot.h>
 
 #include <filesystem>
+#include <limits>
 
 #include "plot_metadata.hpp"
 #include "types.hpp"
+#include "utils/memory_accounting.hpp"
 
 namespace sim {
 
@@ -16,11 +18,15 @@ public:
     void export_to_file(std::filesystem::path path) const;
     matplot::figure_handle get_picture(PlotMetadata metadata) const;
     void draw_plot(std::filesystem::path path, PlotMetadata metadata) const;
-    void draw_on_plot(matplot::figure_handle& fig,
-                      std::string_view name = "") const;
+    void draw_on_plot(matplot::figure_handle& fig, std::string_view name = "",
+                      std::size_t max_points = std::numeric_limits<
+                          std::size_t>::max()) const;
 
 private:
-    std::vector<std::pair<TimeNs, double> > m_records;
+    std::vector<std::pair<TimeNs, double>,
+                TrackingAllocator<std::pair<TimeNs, double>,
+                                  MemorySubsystem::Metrics> >
+        m_records;
 };
 
 }  // namespace sim
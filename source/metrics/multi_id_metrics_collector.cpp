@@ -24,6 +24,8 @@ void MultiIdMetricsStorage::add_record(Id id, TimeNs time, double value) {
     }
 }
 
+void MultiIdMetricsStorage::remove(const Id& id) { m_storage.erase(id); }
+
 void MultiIdMetricsStorage::export_to_files(
     std::filesystem::path output_dir_path) const {
     for (auto& [id, values] : m_storage) {
@@ -46,13 +48,22 @@ void MultiIdMetricsStorage::draw_on_plot(
     draw_on_same_plot(path, std::move(data), std::move(metadata));
 }
 
-void MultiIdMetricsStorage::draw_on_different_plots(
+std::vector<PlotTask> MultiIdMetricsStorage::get_different_plots_tasks(
     std::filesystem::path path, PlotMetadata metadata) const {
-    for (auto [id, storage] : data()) {
+    std::vector<PlotTask> tasks;
+    for (const auto& [id, maybe_storage] : m_storage) {
+        if (!maybe_storage) {
+            continue;
+        }
         PlotMetadata storage_metadata = metadata;
         storage_metadata.title += " for " + id;
-        storage.draw_plot(path / (id + ".svg"), storage_metadata);
+        tasks.push_back([&storage = maybe_storage.value(),
+                         plot_path = path / (id + ".svg"),
+                         storage_metadata = std::move(storage_metadata)]() {
+            storage.draw_plot(plot_path, storage_metadata);
+        });
     }
+    return tasks;
 }
 
 std::unordered_map<Id, MetricsStorage> MultiIdMetricsStorage::data() const {
@@ -4,6 +4,7 @@
 #include <regex>
 #include <type_traits>
 
+#include "draw_plots.hpp"
 #include "metrics_storage.hpp"
 namespace sim {
 class MultiIdMetricsStorage {
@@ -11,14 +12,17 @@ public:
     MultiIdMetricsStorage(std::string a_metric_name, std::string a_filter);
 
     void add_record(Id id, TimeNs time, double value);
+    // Frees records of id, so they are neither exported nor drawn
+    void remove(const Id& id);
     void export_to_files(std::filesystem::path output_dir_path) const;
 
     void draw_on_plot(
         std::filesystem::path path, PlotMetadata metadata,
         std::function<std::string(const Id&)> id_to_curve_name) const;
 
-    void draw_on_different_plots(std::filesystem::path dir_path,
-                                 PlotMetadata metadata) const;
+    // Tasks that draw every id on its own plot
+    std::vector<PlotTask> get_different_plots_tasks(
+        std::filesystem::path dir_path, PlotMetadata metadata) const;
 
     std::unordered_map<Id, MetricsStorage> data() const;
 
@@ -1,20 +1,43 @@
 #include "simple_packet_reordering.hpp"
 
+#include <spdlog/fmt/fmt.h>
+
+#include <bit>
+#include <stdexcept>
+
 namespace sim {
 
-SimplePacketReordering::SimplePacketReordering(std::size_t a_max_packets)
-    : m_max_packets(a_max_packets), m_inversions_count(0) {}
+SimplePacketReordering::SimplePacketReordering(std::size_t a_window_size)
+    : m_window_size(std::bit_ceil(a_window_size)),
+      m_window_first(0),
+      m_arrived_in_window(0),
+      m_inversions_count(0),
+      m_arrived(m_window_size) {
+    if (a_window_size == 0 || m_window_size > M_MAX_WINDOW_SIZE) {
+        throw std::invalid_argument(
+            fmt::format("Packet reordering window size should be in [1, {}]",
+                        M_MAX_WINDOW_SIZE));
+    }
+}
 
 void SimplePacketReordering::add_record(PacketNum packet_num) {
-    m_packet_num_set.insert(packet_num);
-    std::size_t count_lower = m_packet_num_set.order_of_key(packet_num);
-    std::size_t total_count = m_packet_num_set.size();
-    std::size_t count_upper = total_count - count_lower - 1;
+    if (packet_num >= m_window_first &&
+        packet_num - m_window_first >= m_window_size) {
+        slide_window(packet_num - m_window_size + 1);
+    }
+    if (packet_num < m_window_first) {
+        m_inversions_count += m_arrived_in_window;
+        return;
+    }
 
-    m_inversions_count += count_upper;
+    // count arrived packets with greater numbers
+    std::size_t window_last = m_window_first + m_window_size - 1;
+    m_inversions_count +=
+        count_arrived(packet_num + 1, window_last - packet_num);
 
-    if (m_packet_num_set.size() > m_max_packets) {
-        m_packet_num_set.erase(m_packet_num_set.begin());
+    if (count_arrived(packet_num, 1) == 0) {
+        m_arrived.add(packet_num & (m_window_size - 1), 1);
+        m_arrived_in_window++;
     }
 }
 
@@ -22,4 +45,29 @@ PacketReordering SimplePacketReordering::value() const {
     return m_inversions_count;
 }
 
-};  // namespace sim
\ No newline at end of file
+std::size_t SimplePacketReordering::count_arrived(PacketNum first,
+                                                  std::size_t count) const {
+    std::size_t index = first & (m_window_size - 1);
+    if (index + count <= m_window_size) {
+        return m_arrived.range_sum(index, index + count);
+    }
+    return m_arrived.range_sum(index, m_window_size) +
+           m_arrived.prefix_sum(index + count - m_window_size);
+}
+
+void SimplePacketReordering::slide_window(PacketNum new_window_first) {
+    if (new_window_first - m_window_first >= m_window_size) {
+        m_arrived.clear();
+        m_arrived_in_window = 0;
+    } else {
+        for (PacketNum num = m_window_first; num < new_window_first; num++) {
+            if (count_arrived(num, 1) != 0) {
+                m_arrived.subtract(num & (m_window_size - 1), 1);
+                m_arrived_in_window--;
+            }
+        }
+    }
+    m_window_first = new_window_first;
+}
+
+};  // namespace sim
@@ -1,22 +1,39 @@
 #pragma once
 #include "i_packet_reordering.hpp"
-#include "utils/ordered_set.hpp"
-#include "utils/statistics.hpp"
+#include "utils/fenwick_tree.hpp"
 
 namespace sim {
+
+// Counts inversions in sequence of arrived packet numbers.
+// Only packets with numbers from the window [m_window_first, m_window_first +
+// window size) are tracked; window slides forward with the largest arrived
+// number. Packet that is older than window is counted as inversion with
+// every tracked packet
 class SimplePacketReordering : public IPacketReordering {
 public:
-    explicit SimplePacketReordering(std::size_t a_max_packets = 1'000'000);
+    static constexpr std::size_t M_DEFAULT_WINDOW_SIZE = 1024;
+    // Counters in tree are 16-bit, so window can not be larger
+    static constexpr std::size_t M_MAX_WINDOW_SIZE = 32768;
+
+    // a_window_size is rounded up to the power of two
+    explicit SimplePacketReordering(
+        std::size_t a_window_size = M_DEFAULT_WINDOW_SIZE);
     ~SimplePacketReordering() = default;
 
     void add_record(PacketNum packet_num) final;
     PacketReordering value() const final;
 
 private:
-    // maximal count of packets in m_packet_num_set
-    // When m_packet_num_set.size() growth up it, the smallest element deletes
-    std::size_t m_max_packets;
+    // Returns number of arrived packets with numbers from
+    // [first, first + count); count <= window size
+    std::size_t count_arrived(PacketNum first, std::size_t count) const;
+    void slide_window(PacketNum new_window_first);
+
+    std::size_t m_window_size;
+    PacketNum m_window_first;
+    std::size_t m_arrived_in_window;
     uint64_t m_inversions_count;
-    utils::ordered_set<PacketNum> m_packet_num_set;
+    // Packet number n is stored in n % m_window_size position
+    utils::FenwickTree<std::uint16_t> m_arrived;
 };
-}  // namespace sim
\ No newline at end of file
+}  // namespace sim
@@ -1,4 +1,6 @@
 #pragma once
+#include <cstddef>
+#include <limits>
 #include <string>
 
 namespace sim {
@@ -7,5 +9,7 @@ struct PlotMetadata {
     std::string x_label;
     std::string y_label;
     std::string title;
+    // Longer curves are decimated (see decimate_min_max)
+    std::size_t max_points_per_curve = std::numeric_limits<std::size_t>::max();
 };
 }  // namespace sim
\ No newline at end of file
@@ -0,0 +1,117 @@
+#include "steady_state_detector.hpp"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <limits>
+
+#include "logger/logger.hpp"
+#include "utils/filesystem.hpp"
+
+namespace sim {
+
+std::string to_string(SteadyStateMetric metric) {
+    switch (metric) {
+        case SteadyStateMetric::Throughput:
+            return "throughput";
+        case SteadyStateMetric::QueueSize:
+            return "queue_size";
+        default:
+            LOG_ERROR(fmt::format("Undefined steady state metric: {}",
+                                  static_cast<int>(metric)));
+            return "unknown";
+    }
+}
+
+// Quantile of Student's t-distribution for 95% two-sided interval. Exact
+// values are tabulated for few degrees of freedom, where approximation is far
+// too low (7.15 instead of 12.71 for one degree); above them Cornish-Fisher
+// expansion around normal quantile is accurate to 1e-4
+static double student_quantile_95(std::size_t degrees_of_freedom) {
+    static constexpr std::array<double, 30> exact_quantiles = {
+        12.7062, 4.3027, 3.1824, 2.7764, 2.5706, 2.4469, 2.3646, 2.3060,
+        2.2622,  2.2281, 2.2010, 2.1788, 2.1604, 2.1448, 2.1314, 2.1199,
+        2.1098,  2.1009, 2.0930, 2.0860, 2.0796, 2.0739, 2.0687, 2.0639,
+        2.0595,  2.0555, 2.0518, 2.0484, 2.0452, 2.0423};
+    if (degrees_of_freedom == 0) {
+        return std::numeric_limits<double>::infinity();
+    }
+    if (degrees_of_freedom <= exact_quantiles.size()) {
+        return exact_quantiles[degrees_of_freedom - 1];
+    }
+    const double z = 1.959964;
+    const double v = static_cast<double>(degrees_of_freedom);
+    return z + (z * z * z + z) / (4 * v) +
+           (5 * std::pow(z, 5) + 16 * z * z * z + 3 * z) / (96 * v * v);
+}
+
+SteadyStateDetector::SteadyStateDetector(SteadyStateMetric a_metric,
+                                         TimeNs a_batch_duration,
+                                         std::size_t a_min_batches,
+                                         double a_relative_precision)
+    : m_metric(a_metric),
+      m_batch_duration(a_batch_duration),
+      m_min_batches(std::max<std::size_t>(a_min_batches, 2)),
+      m_relative_precision(a_relative_precision),
+      m_batches_count(0),
+      m_mean(0),
+      m_squared_deviations_sum(0) {}
+
+void SteadyStateDetector::add_batch(double value) {
+    m_batches_count++;
+    double delta = value - m_mean;
+    m_mean += delta / m_batches_count;
+    m_squared_deviations_sum += delta * (value - m_mean);
+}
+
+bool SteadyStateDetector::is_converged() const {
+    return m_batches_count >= m_min_batches &&
+           get_half_width() <= m_relative_precision * std::abs(m_mean);
+}
+
+SteadyStateMetric SteadyStateDetector::get_metric() const { return m_metric; }
+
+TimeNs SteadyStateDetector::get_batch_duration() const {
+    return m_batch_duration;
+}
+
+std::size_t SteadyStateDetector::get_batches_count() const {
+    return m_batches_count;
+}
+
+double SteadyStateDetector::get_mean() const { return m_mean; }
+
+double SteadyStateDetector::get_half_width() const {
+    if (m_batches_count < 2) {
+        return std::numeric_limits<double>::infinity();
+    }
+    double variance = m_squared_deviations_sum / (m_batches_count - 1);
+    return student_quantile_95(m_batches_count - 1) *
+           std::sqrt(variance / m_batches_count);
+}
+
+void SteadyStateDetector::write_to_json(
+    const std::filesystem::path& path) const {
+    utils::create_all_directories(path);
+    std::ofstream out(path);
+    // Infinite half-width is not valid JSON
+    double half_width = get_half_width();
+    out << fmt::format(
+        "{{\n"
+        "  \"metric\": \"{}\",\n"
+        "  \"batch_duration_ns\": {},\n"
+        "  \"batches\": {},\n"
+        "  \"mean\": {},\n"
+        "  \"half_width\": {},\n"
+        "  \"converged\": {}\n"
+        "}}\n",
+        to_string(m_metric), m_batch_duration.value(), m_batches_count, m_mean,
+        (std::isinf(half_width) ? std::string("null")
+                                : fmt::format("{}", half_width)),
+        is_converged());
+}
+
+}  // namespace sim
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+
+#include "types.hpp"
+
+namespace sim {
+
+enum class SteadyStateMetric {
+    // Data delivered by all flows per batch, Gbps
+    Throughput,
+    // Total size of all link queues at the end of batch, bytes
+    QueueSize
+};
+
+std::string to_string(SteadyStateMetric metric);
+
+// Detects steady state by batch means method: simulation time after warm-up
+// is divided into batches of equal duration and every batch gives one
+// observation of the metric. Batches are assumed long enough to be nearly
+// independent, so confidence interval of the mean is estimated from them as
+// from independent samples; the run may stop once its half-width is within
+// relative precision of the mean
+class SteadyStateDetector {
+public:
+    SteadyStateDetector(SteadyStateMetric a_metric, TimeNs a_batch_duration,
+                        std::size_t a_min_batches = 20,
+                        double a_relative_precision = 0.05);
+
+    void add_batch(double value);
+
+    // True if at least min_batches batches are added and half-width of 95%
+    // confidence interval is not greater than relative_precision * |mean|
+    bool is_converged() const;
+
+    SteadyStateMetric get_metric() const;
+    TimeNs get_batch_duration() const;
+    std::size_t get_batches_count() const;
+    double get_mean() const;
+    // Half-width of 95% confidence interval of the mean
+    double get_half_width() const;
+
+    void write_to_json(const std::filesystem::path& path) const;
+
+private:
+    SteadyStateMetric m_metric;
+    TimeNs m_batch_duration;
+    std::size_t m_min_batches;
+    double m_relative_precision;
+
+    // Welford's online mean and variance
+    std::size_t m_batches_count;
+    double m_mean;
+    double m_squared_deviations_sum;
+};
+
+}  // namespace sim
@@ -2,6 +2,8 @@
 
 #include <sstream>
 
+#include "utils/hash.hpp"
+
 namespace sim {
 
 Packet::Packet(SizeByte a_size, IFlow* a_flow, Id a_source_id, Id a_dest_id,
@@ -17,7 +19,9 @@ Packet::Packet(SizeByte a_size, IFlow* a_flow, Id a_source_id, Id a_dest_id,
       sent_time(a_sent_time),
       delivered_data_size_at_origin(a_delivered_data_size_at_origin),
       ecn_capable_transport(a_ecn_capable_transport),
-      congestion_experienced(a_congestion_experienced) {}
+      congestion_experienced(a_congestion_experienced) {
+    update_header_hashes();
+}
 
 bool Packet::operator==(const Packet& packet) const {
     return flow == packet.flow && source_id == packet.source_id &&
@@ -25,6 +29,12 @@ bool Packet::operator==(const Packet& packet) const {
            flags == packet.flags;
 }
 
+void Packet::update_header_hashes() {
+    flow_hash = utils::hash_string(flow == nullptr ? "" : flow->get_id());
+    source_hash = utils::hash_string(source_id);
+    dest_hash = utils::hash_string(dest_id);
+}
+
 // TODO: think about some ID for packet (currently its impossible to distinguish
 // packets)
 std::string Packet::to_string() const {
@@ -43,4 +53,10 @@ std::string Packet::to_string() const {
     return oss.str();
 }
 
+void Packet::notify_lost() const {
+    if (flow != nullptr) {
+        flow->on_packet_lost();
+    }
+}
+
 }  // namespace sim
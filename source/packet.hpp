@@ -8,6 +8,7 @@
 namespace sim {
 
 using PathHash = std::uint32_t;
+using HeaderHash = std::uint64_t;
 
 struct Packet {
     Packet(SizeByte a_size = SizeByte(0), IFlow* a_flow = nullptr,
@@ -20,6 +21,13 @@ struct Packet {
     bool operator==(const Packet& packet) const;
     std::string to_string() const;
 
+    // Recalculates header hashes from flow id, source_id and dest_id
+    void update_header_hashes();
+
+    // Should be called wherever packet is dropped, so flow knows when no
+    // packets refer to it
+    void notify_lost() const;
+
     PacketNum packet_num = 0;
     BitSet<PacketFlagsBase> flags;
     Id source_id;
@@ -35,6 +43,12 @@ struct Packet {
     PathHash path_hash = 0;
     bool ecn_capable_transport;
     bool congestion_experienced;
+
+    // Hashes of header identifiers. Calculated once (by constructor or by the
+    // flow that caches them) so hashers work with integers on every hop
+    HeaderHash flow_hash = 0;
+    HeaderHash source_hash = 0;
+    HeaderHash dest_hash = 0;
 };
 
 }  // namespace sim
@@ -0,0 +1,183 @@
+#include "range_expansion.hpp"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <charconv>
+
+namespace sim {
+
+// Parses `first..last`; returns std::nullopt if text has another format
+static std::optional<std::pair<std::size_t, std::size_t>> parse_range(
+    std::string_view text) {
+    std::size_t separator = text.find("..");
+    if (separator == std::string_view::npos) {
+        return std::nullopt;
+    }
+    auto parse_number = [](std::string_view number) {
+        std::size_t value = 0;
+        auto [end, error] = std::from_chars(
+            number.data(), number.data() + number.size(), value);
+        bool correct = error == std::errc() && !number.empty() &&
+                       end == number.data() + number.size();
+        return (correct ? std::optional(value) : std::nullopt);
+    };
+    auto first = parse_number(text.substr(0, separator));
+    auto last = parse_number(text.substr(separator + 2));
+    if (!first || !last) {
+        return std::nullopt;
+    }
+    return std::make_pair(first.value(), last.value());
+}
+
+std::string RangedName::get_name(std::size_t index) const {
+    return fmt::format("{}{}{}", prefix, index, suffix);
+}
+
+std::optional<RangedName> parse_ranged_name(const std::string& name) {
+    std::size_t open = name.find('[');
+    while (open != std::string::npos) {
+        std::size_t close = name.find(']', open);
+        if (close == std::string::npos) {
+            return std::nullopt;
+        }
+        auto range = parse_range(
+            std::string_view(name).substr(open + 1, close - open - 1));
+        if (range) {
+            if (range->first > range->second) {
+                throw std::runtime_error(fmt::format(
+                    "Range in name {} has first index greater than last",
+                    name));
+            }
+            return RangedName{name.substr(0, open), range->first,
+                              range->second, name.substr(close + 1)};
+        }
+        open = name.find('[', close);
+    }
+    return std::nullopt;
+}
+
+std::vector<std::string> expand_names(const std::string& name) {
+    std::optional<RangedName> ranged_name = parse_ranged_name(name);
+    if (!ranged_name) {
+        return {name};
+    }
+    std::vector<std::string> names;
+    for (std::size_t i = ranged_name->first; i <= ranged_name->last; i++) {
+        names.push_back(ranged_name->get_name(i));
+    }
+    return names;
+}
+
+static bool contains_placeholder(const YAML::Node& node) {
+    if (node.IsScalar()) {
+        return node.Scalar().find(INDEX_PLACEHOLDER) != std::string::npos;
+    }
+    if (node.IsSequence()) {
+        for (const auto& child : node) {
+            if (contains_placeholder(child)) {
+                return true;
+            }
+        }
+    }
+    if (node.IsMap()) {
+        for (const auto& child : node) {
+            if (contains_placeholder(child.second)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Returns deep copy of node with index placeholders replaced by index
+static YAML::Node substitute_index(const YAML::Node& node,
+                                   const std::string& index) {
+    if (node.IsScalar()) {
+        std::string value = node.Scalar();
+        for (std::size_t pos = value.find(INDEX_PLACEHOLDER);
+             pos != std::string::npos;
+             pos = value.find(INDEX_PLACEHOLDER, pos + index.size())) {
+            value.replace(pos, INDEX_PLACEHOLDER.size(), index);
+        }
+        return YAML::Node(value);
+    }
+    if (node.IsSequence()) {
+        YAML::Node result(YAML::NodeType::Sequence);
+        for (const auto& child : node) {
+            result.push_back(substitute_index(child, index));
+        }
+        return result;
+    }
+    if (node.IsMap()) {
+        YAML::Node result(YAML::NodeType::Map);
+        for (const auto& child : node) {
+            result[child.first.Scalar()] =
+                substitute_index(child.second, index);
+        }
+        return result;
+    }
+    return node;
+}
+
+// Calls func for body of ranged entry for every index of range
+static void for_each_index(
+    const YAML::Node& body, std::size_t first, std::size_t last,
+    const std::function<void(const YAML::Node&, std::size_t)>& func) {
+    // bodies without placeholders (e.g. empty host entries) are not copied
+    bool has_placeholder = contains_placeholder(body);
+    for (std::size_t i = first; i <= last; i++) {
+        if (has_placeholder) {
+            func(substitute_index(body, std::to_string(i)), i);
+        } else {
+            func(body, i);
+        }
+    }
+}
+
+void for_each_expanded_child(
+    const ConfigNode& map_node,
+    const std::function<void(const ConfigNode&)>& func) {
+    for (auto it = map_node.begin(); it != map_node.end(); ++it) {
+        ConfigNode child = *it;
+        std::optional<RangedName> ranged_name;
+        try {
+            ranged_name = parse_ranged_name(child.get_name_or_throw());
+        } catch (const std::runtime_error& e) {
+            throw child.create_parsing_error(e.what());
+        }
+        if (!ranged_name) {
+            func(child);
+            continue;
+        }
+        for_each_index(child.get_node(), ranged_name->first,
+                       ranged_name->last,
+                       [&func, &ranged_name](const YAML::Node& body,
+                                             std::size_t index) {
+                           func(ConfigNode(body, ranged_name->get_name(index)));
+                       });
+    }
+}
+
+void for_each_expanded_element(
+    const ConfigNode& sequence_node,
+    const std::function<void(const ConfigNode&)>& func) {
+    for (const auto& element : sequence_node) {
+        ConfigNodeExpected range_node = element["range"];
+        if (!range_node) {
+            func(element);
+            continue;
+        }
+        auto range =
+            parse_range(range_node.value().as_or_throw<std::string>());
+        if (!range || range->first > range->second) {
+            throw range_node.value().create_parsing_error(
+                "Range should look like <first>..<last> with first <= last");
+        }
+        for_each_index(element.get_node(), range->first, range->second,
+                       [&func](const YAML::Node& body, std::size_t) {
+                           func(ConfigNode(body));
+                       });
+    }
+}
+
+}  // namespace sim
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "config_node.hpp"
+
+namespace sim {
+
+// Compact syntax for repeated config entries.
+// Name `prefix[first..last]suffix` stands for names prefix<i>suffix with i
+// from first to last inclusive. Inside body of such entry every `[i]` in
+// scalars is replaced by the current index, e.g.
+//
+// connections:
+//   conn[1..1024]:
+//     sender_id: sender[i]
+//     receiver_id: receiver
+//
+// Entries are expanded one by one while config is processed, so ranges do
+// not make config bigger in memory
+
+// Placeholder of index in bodies of ranged entries
+inline constexpr std::string_view INDEX_PLACEHOLDER = "[i]";
+
+struct RangedName {
+    std::string prefix;
+    std::size_t first;
+    std::size_t last;
+    std::string suffix;
+
+    std::string get_name(std::size_t index) const;
+};
+
+// Returns std::nullopt if name does not contain range
+std::optional<RangedName> parse_ranged_name(const std::string& name);
+
+// Returns all names given by (possibly ranged) name
+std::vector<std::string> expand_names(const std::string& name);
+
+// Calls func for every child of map node; ranged children are expanded
+void for_each_expanded_child(
+    const ConfigNode& map_node,
+    const std::function<void(const ConfigNode&)>& func);
+
+// Calls func for every element of sequence node; element with field
+// `range: first..last` is repeated for every index of the range (with `[i]`
+// replaced in its scalars)
+void for_each_expanded_element(
+    const ConfigNode& sequence_node,
+    const std::function<void(const ConfigNode&)>& func);
+
+}  // namespace sim
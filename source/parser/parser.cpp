@@ -1,10 +1,13 @@
 #include "parser/parser.hpp"
 
+#include <algorithm>
 #include <stdexcept>
 
 #include "logger/logger.hpp"
+#include "metrics/metrics_collector.hpp"
 #include "parser/simulation/connection/connection_parser.hpp"
 #include "parser/simulation/scenario/scenario_parser.hpp"
+#include "parser/topology/generator/topology_generator.hpp"
 #include "parser/topology/host/host_parser.hpp"
 #include "parser/topology/link/link_parser.hpp"
 #include "parser/topology/switch/switch_parser.hpp"
@@ -17,6 +20,7 @@ Simulator YamlParser::build_simulator_from_config(
     const ConfigNode simulation_config = load_file(path);
 
     m_simulator = Simulator();
+    m_simulation_config_dir = path.parent_path();
 
     m_topology_config_path =
         path.parent_path() / simulation_config["topology_config_path"]
@@ -35,21 +39,50 @@ Simulator YamlParser::build_simulator_from_config(
 
     const ConfigNode packet_spraying_node =
         topology_config["packet-spraying"].value_or_throw();
-    parse_if_present(topology_config["hosts"],
-                     [this](ConfigNode node) { process_hosts(node); });
-
-    parse_if_present(topology_config["switches"],
-                     [this, &packet_spraying_node](ConfigNode node) {
-                         return process_switches(node, packet_spraying_node);
-                     });
 
     ConfigNode links_preset_node =
         topology_presets_node.value_or(ConfigNode())["link"].value_or(
             ConfigNode());
-    parse_if_present(topology_config["links"],
-                     [this, &links_preset_node](ConfigNode node) {
-                         process_links(node, links_preset_node);
-                     });
+    // Maps preset name to preset body
+    LinkPresets link_presets = LinkPresets::parse_presets(
+        links_preset_node, [](const ConfigNode &preset_node) {
+            LinkInitArgs args;
+            LinkParser::parse_to_args(preset_node, args);
+            return args;
+        });
+
+    // Generated devices and links go first; explicitly listed ones may be
+    // added to them, so topology sections become optional
+    ConfigNodeExpected generator_node = topology_config["generator"];
+    generator_node.apply_if_present(
+        [this, &link_presets, &packet_spraying_node](ConfigNode node) {
+            TopologyGenerator::generate(node, link_presets,
+                                        packet_spraying_node, m_simulator);
+        });
+    auto parse_topology_section = [&generator_node, &parse_if_present](
+                                      ConfigNodeExpected node,
+                                      std::function<void(ConfigNode)> parser) {
+        if (generator_node.has_value()) {
+            node.apply_if_present(parser);
+        } else {
+            parse_if_present(node, parser);
+        }
+    };
+
+    parse_topology_section(topology_config["hosts"], [this](ConfigNode node) {
+        process_hosts(node);
+    });
+
+    parse_topology_section(topology_config["switches"],
+                           [this, &packet_spraying_node](ConfigNode node) {
+                               return process_switches(node,
+                                                       packet_spraying_node);
+                           });
+
+    parse_topology_section(topology_config["links"],
+                           [this, &link_presets](ConfigNode node) {
+                               process_links(node, link_presets);
+                           });
 
     parse_if_present(simulation_config["connections"],
                      [this](ConfigNode node) { process_connection(node); });
@@ -61,10 +94,29 @@ Simulator YamlParser::build_simulator_from_config(
     if (maybe_stop_time.has_value()) {
         m_simulator.set_stop_time(parse_time(maybe_stop_time.value()));
     }
+    m_simulator.set_stop_on_completion(simple_parse_with_default(
+        simulation_config, "stop_on_completion", false));
+
+    simulation_config["measurement"].apply_if_present(
+        [this](ConfigNode node) { process_measurement(node); });
 
     return std::move(m_simulator);
 }
 
+void YamlParser::apply_branch_config(const std::filesystem::path &path,
+                                     Simulator &simulator) {
+    const ConfigNode branch_config = load_file(path);
+    branch_config["scenario"].apply_if_present(
+        [&simulator, &path](ConfigNode node) {
+            simulator.add_scenario(
+                ScenarioParser::parse(node, path.parent_path()));
+        });
+    ConfigNodeExpected maybe_stop_time = branch_config["simulation_time"];
+    if (maybe_stop_time.has_value()) {
+        simulator.set_stop_time(parse_time(maybe_stop_time.value()));
+    }
+}
+
 void YamlParser::process_hosts(const ConfigNode &hosts_node) {
     process_identifiables<IHost>(
         hosts_node,
@@ -88,21 +140,19 @@ void YamlParser::process_switches(const ConfigNode &switches_node,
 }
 
 void YamlParser::process_links(const ConfigNode &links_node,
-                               const ConfigNode &link_presets_node) {
-    // Maps preset name to preset body
-    LinkPresets presets = LinkPresets::parse_presets(
-        link_presets_node, [](const ConfigNode &preset_node) {
-            LinkInitArgs args;
-            LinkParser::parse_to_args(preset_node, args);
-            return args;
-        });
-    process_identifiables<ILink>(
-        links_node,
-        [this](std::shared_ptr<ILink> link) {
-            return m_simulator.add_link(link);
-        },
-        [&presets](const ConfigNode &link_node) {
-            return LinkParser::parse_i_link(link_node, presets);
+                               const LinkPresets &presets) {
+    // Link entries with `connect` field describe several links
+    auto add_link = [this, &presets](const ConfigNode &link_node) {
+        std::shared_ptr<ILink> link =
+            LinkParser::parse_i_link(link_node, presets);
+        if (auto result = m_simulator.add_link(link); !result.has_value()) {
+            throw std::runtime_error(
+                fmt::format("{}; Id: {}", result.error(), link->get_id()));
+        }
+    };
+    for_each_expanded_child(
+        links_node, [&add_link](const ConfigNode &link_node) {
+            LinkParser::for_each_link_node(link_node, add_link);
         });
 }
 
@@ -115,8 +165,70 @@ void YamlParser::process_connection(const ConfigNode &connections_node) {
         ConnectionParser::parse_i_connection);
 }
 
+void YamlParser::process_measurement(const ConfigNode &measurement_node) {
+    std::vector<TimeWindow> windows;
+    measurement_node["windows"].apply_if_present([&windows](
+                                                     ConfigNode windows_node) {
+        if (!windows_node.IsSequence()) {
+            throw windows_node.create_parsing_error(
+                "Node should be a sequence");
+        }
+        for (const ConfigNode &window_node : windows_node) {
+            TimeWindow window{parse_time(window_node["from"].value_or_throw()),
+                              std::nullopt};
+            window_node["to"].apply_if_present([&window](ConfigNode to_node) {
+                window.to = parse_time(to_node);
+            });
+            if (window.to.has_value() && !(window.to.value() > window.from)) {
+                throw window_node.create_parsing_error(
+                    "Window should end after its start");
+            }
+            windows.push_back(window);
+        }
+    });
+    // Steady state is measured from the first window (i.e. after warm-up)
+    TimeNs measurement_start = TimeNs(0);
+    if (!windows.empty()) {
+        measurement_start = std::min_element(windows.begin(), windows.end(),
+                                             [](const auto &a, const auto &b) {
+                                                 return b.from > a.from;
+                                             })
+                                ->from;
+    }
+    MetricsCollector::get_instance().set_recording_windows(std::move(windows));
+
+    measurement_node["steady_state"].apply_if_present(
+        [this, measurement_start](ConfigNode node) {
+            std::string metric_name =
+                node["metric"].value_or_throw().as_or_throw<std::string>();
+            SteadyStateMetric metric;
+            if (metric_name == "throughput") {
+                metric = SteadyStateMetric::Throughput;
+            } else if (metric_name == "queue_size") {
+                metric = SteadyStateMetric::QueueSize;
+            } else {
+                throw node.create_parsing_error(fmt::format(
+                    "Unexpected steady state metric: {}", metric_name));
+            }
+            TimeNs batch = parse_time(node["batch"].value_or_throw());
+            if (!(batch > TimeNs(0))) {
+                throw node.create_parsing_error(
+                    "Batch duration should be positive");
+            }
+            m_simulator.set_steady_state_detector(
+                SteadyStateDetector(
+                    metric, batch,
+                    simple_parse_with_default<std::size_t>(node, "min_batches",
+                                                           20),
+                    simple_parse_with_default(node, "relative_precision",
+                                              0.05)),
+                measurement_start);
+        });
+}
+
 void YamlParser::process_scenario(const ConfigNode &scenario_node) {
-    auto scenario = ScenarioParser::parse(scenario_node);
+    auto scenario =
+        ScenarioParser::parse(scenario_node, m_simulation_config_dir);
     m_simulator.set_scenario(std::move(scenario));
 }
 
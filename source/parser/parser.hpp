@@ -6,6 +6,8 @@
 #include <utility>
 
 #include "parser/config_reader/config_node.hpp"
+#include "parser/config_reader/range_expansion.hpp"
+#include "parser/topology/link/link_parser.hpp"
 #include "simulator.hpp"
 
 namespace sim {
@@ -14,8 +16,15 @@ class YamlParser {
 public:
     Simulator build_simulator_from_config(const std::filesystem::path& path);
 
+    // Applies config of branch forked by Simulator::fork_at: actions of its
+    // `scenario` are added to simulation and `simulation_time` (optional)
+    // schedules one more stop
+    static void apply_branch_config(const std::filesystem::path& path,
+                                    Simulator& simulator);
+
 private:
-    // node - contains information about set of identifiable objects
+    // node - contains information about set of identifiable objects; ranged
+    // entries are expanded (see range_expansion.hpp)
     // add_func- function to add new object to simulator
     // parse_func- function to parser single object from config
     // message - error message, which will be printed in case of failing to add
@@ -28,14 +37,14 @@ private:
         static_assert(std::is_base_of_v<Identifiable, T>,
                       "T must be Identifiable");
 
-        for (auto it = node.begin(); it != node.end(); ++it) {
-            std::shared_ptr<T> ptr = parse_func(*it);
+        for_each_expanded_child(node, [&](const ConfigNode& child) {
+            std::shared_ptr<T> ptr = parse_func(child);
 
             if (auto result = add_func(ptr); !result.has_value()) {
                 throw std::runtime_error(
                     fmt::format("{}; Id: {}", result.error(), ptr->get_id()));
             }
-        }
+        });
     }
 
     void process_hosts(const ConfigNode& hosts_node);
@@ -44,11 +53,13 @@ private:
 
     void process_connection(const ConfigNode& connections_node);
     void process_links(const ConfigNode& links_node,
-                       const ConfigNode& link_preset_node);
+                       const LinkPresets& link_presets);
     void process_scenario(const ConfigNode& scenario_node);
+    void process_measurement(const ConfigNode& measurement_node);
 
     Simulator m_simulator;
     std::filesystem::path m_topology_config_path;
+    std::filesystem::path m_simulation_config_dir;
     std::unique_ptr<Scenario> m_scenario;
 };
 
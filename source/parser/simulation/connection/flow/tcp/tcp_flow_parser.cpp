@@ -15,8 +15,11 @@ std::shared_ptr<TcpFlow> TcpFlowParser::parse_tcp_flow(
     SizeByte packet_size =
         SizeByte(parse_size(node["packet_size"].value_or_throw()));
 
+    bool reordering_metric =
+        simple_parse_with_default(node, "reordering_metric", true);
+
     return std::make_shared<TcpFlow>(flow_id, connection, std::move(cc),
-                                     packet_size);
+                                     packet_size, true, reordering_metric);
 }
 
 }  // namespace sim
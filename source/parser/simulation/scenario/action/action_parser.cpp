@@ -3,18 +3,94 @@
 #include <regex>
 #include <sstream>
 
+#include "connection/i_connection.hpp"
 #include "parser/parse_utils.hpp"
+#include "utils/hash.hpp"
 #include "utils/identifier_factory.hpp"
 
 namespace sim {
 
-std::unique_ptr<IAction> ActionParser::parse(const ConfigNode& node) {
+std::unique_ptr<IAction> ActionParser::parse(
+    const ConfigNode& node, const std::filesystem::path& config_dir) {
     const std::string action =
         node["action"].value_or_throw().as_or_throw<std::string>();
     if (action == "send_data") {
         return parse_send_data(node);
     }
+    if (action == "poisson") {
+        return parse_poisson(node);
+    }
+    if (action == "on_off") {
+        return parse_on_off(node);
+    }
+    if (action == "trace_replay") {
+        return parse_trace_replay(node, config_dir);
+    }
     throw node.create_parsing_error("Unknown scenario action: " + action);
 }
 
+std::vector<std::weak_ptr<IConnection>> ActionParser::parse_connections(
+    const ConfigNode& node) {
+    const std::regex re = parse_regex(node["connections"].value_or_throw());
+
+    std::vector<std::weak_ptr<IConnection>> conns;
+    auto& factory = IdentifierFactory::get_instance();
+    for (const auto& conn : factory.get_objects<IConnection>()) {
+        if (std::regex_match(conn->get_id(), re)) {
+            conns.push_back(conn);
+        }
+    }
+    if (conns.empty()) {
+        throw node.create_parsing_error(
+            "No connections specified for action");
+    }
+    return conns;
+}
+
+SizeDistribution ActionParser::parse_size_distribution(
+    const ConfigNode& node) {
+    ConfigNodeExpected size_node = node["size"];
+    ConfigNodeExpected distribution_node = node["size_distribution"];
+    if (size_node.has_value() == distribution_node.has_value()) {
+        throw node.create_parsing_error(
+            "Exactly one of `size` and `size_distribution` should be set");
+    }
+    if (size_node.has_value()) {
+        return SizeDistribution::constant(parse_size(size_node.value()));
+    }
+    const ConfigNode& distribution = distribution_node.value();
+    if (distribution.IsScalar()) {
+        std::string name = distribution.as_or_throw<std::string>();
+        if (name == "websearch") {
+            return SizeDistribution::websearch();
+        }
+        throw distribution.create_parsing_error(
+            "Unknown size distribution: " + name);
+    }
+    std::vector<SizeDistribution::Point> cdf;
+    for (const ConfigNode point_node : distribution) {
+        if (!point_node.IsSequence() || point_node.size() != 2) {
+            throw point_node.create_parsing_error(
+                "CDF point should look like [<size>, <probability>]");
+        }
+        auto it = point_node.begin();
+        SizeByte size = parse_size(*it);
+        double probability = (*++it).as_or_throw<double>();
+        cdf.push_back({size, probability});
+    }
+    try {
+        return SizeDistribution(std::move(cdf));
+    } catch (const std::invalid_argument& e) {
+        throw distribution.create_parsing_error(e.what());
+    }
+}
+
+std::uint64_t ActionParser::parse_seed(const ConfigNode& node) {
+    if (ConfigNodeExpected seed_node = node["seed"]; seed_node) {
+        return seed_node.value().as_or_throw<std::uint64_t>();
+    }
+    return utils::hash_string(
+        node["connections"].value_or_throw().as_or_throw<std::string>());
+}
+
 }  // namespace sim
@@ -1,20 +1,43 @@
 #pragma once
 
+#include <filesystem>
 #include <memory>
 
 #include "parser/config_reader/config_node.hpp"
 #include "parser/parse_utils.hpp"
 #include "scenario/action/i_action.hpp"
+#include "scenario/action/size_distribution.hpp"
 
 namespace sim {
 
+class IConnection;
+
 class ActionParser {
 public:
-    // Parse one YAML node into an IAction
-    static std::unique_ptr<IAction> parse(const ConfigNode& node);
+    // Parse one YAML node into an IAction; relative paths are relative to
+    // config_dir
+    static std::unique_ptr<IAction> parse(
+        const ConfigNode& node, const std::filesystem::path& config_dir = {});
 
 private:
     static std::unique_ptr<IAction> parse_send_data(const ConfigNode& node);
+    static std::unique_ptr<IAction> parse_poisson(const ConfigNode& node);
+    static std::unique_ptr<IAction> parse_on_off(const ConfigNode& node);
+    static std::unique_ptr<IAction> parse_trace_replay(
+        const ConfigNode& node, const std::filesystem::path& config_dir);
+
+    // Connections with id matching `connections` regex; throws if there are
+    // none
+    static std::vector<std::weak_ptr<IConnection>> parse_connections(
+        const ConfigNode& node);
+
+    // Either fixed `size` or `size_distribution`: name of built-in one
+    // (websearch) or list of CDF points [<size>, <probability>]
+    static SizeDistribution parse_size_distribution(const ConfigNode& node);
+
+    // `seed` if it is set; otherwise derived from connections regex, so
+    // actions with different connections get different streams
+    static std::uint64_t parse_seed(const ConfigNode& node);
 };
 
 }  // namespace sim
@@ -0,0 +1,25 @@
+#include "action_parser.hpp"
+#include "scenario/action/on_off_action.hpp"
+
+namespace sim {
+
+std::unique_ptr<IAction> ActionParser::parse_on_off(const ConfigNode& node) {
+    const TimeNs when = parse_time(node["when"].value_or_throw());
+    const TimeNs on_duration =
+        parse_time(node["on_duration"].value_or_throw());
+    const TimeNs off_duration =
+        parse_time(node["off_duration"].value_or_throw());
+    const TimeNs interval = parse_time(node["interval"].value_or_throw());
+    if (!(interval > TimeNs(0))) {
+        throw node.create_parsing_error("interval should be positive");
+    }
+    const std::size_t bursts_count =
+        simple_parse_with_default<std::size_t>(node, "bursts_count", 1);
+
+    return std::make_unique<OnOffAction>(
+        when, on_duration, off_duration, interval, bursts_count,
+        parse_size_distribution(node), parse_connections(node),
+        parse_seed(node));
+}
+
+}  // namespace sim
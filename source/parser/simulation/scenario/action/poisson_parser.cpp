@@ -0,0 +1,34 @@
+#include "action_parser.hpp"
+#include "scenario/action/poisson_action.hpp"
+
+namespace sim {
+
+std::unique_ptr<IAction> ActionParser::parse_poisson(const ConfigNode& node) {
+    const TimeNs when = parse_time(node["when"].value_or_throw());
+    const TimeNs mean_interval =
+        parse_time(node["mean_interval"].value_or_throw());
+    if (!(mean_interval > TimeNs(0))) {
+        throw node.create_parsing_error("mean_interval should be positive");
+    }
+
+    auto until_node = node["until"];
+    auto count_node = node["count"];
+    if (!until_node && !count_node) {
+        throw node.create_parsing_error(
+            "At least one of `until` and `count` should be set");
+    }
+    std::optional<TimeNs> until;
+    if (until_node) {
+        until = parse_time(until_node.value());
+    }
+    std::optional<std::size_t> count;
+    if (count_node) {
+        count = count_node.value().as_or_throw<std::size_t>();
+    }
+
+    return std::make_unique<PoissonAction>(
+        when, mean_interval, until, count, parse_size_distribution(node),
+        parse_connections(node), parse_seed(node));
+}
+
+}  // namespace sim
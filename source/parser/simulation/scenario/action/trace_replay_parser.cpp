@@ -0,0 +1,66 @@
+#include "action_parser.hpp"
+#include "parser/simulation/connection/connection_parser.hpp"
+#include "scenario/action/trace_replay_action.hpp"
+#include "utils/identifier_factory.hpp"
+
+namespace sim {
+
+std::unique_ptr<IAction> ActionParser::parse_trace_replay(
+    const ConfigNode& node, const std::filesystem::path& config_dir) {
+    const std::filesystem::path trace_path =
+        config_dir /
+        node["trace"].value_or_throw().as_or_throw<std::string>();
+    if (!std::filesystem::exists(trace_path)) {
+        throw node.create_parsing_error(
+            fmt::format("Trace {} does not exist", trace_path.string()));
+    }
+
+    // Connections for host pairs are built from template like usual
+    // connections (mplb, flows); ids are <prefix>_<source>_<destination>
+    // (with _<record number> suffix if every record has its own connection)
+    const ConfigNode connection_node = node["connection"].value_or_throw();
+    connection_node["mplb"].value_or_throw();
+    connection_node["flows"].value_or_throw();
+    const std::string prefix =
+        simple_parse_with_default<std::string>(node, "prefix", "trace");
+
+    // Connections of records are destroyed after they complete (see
+    // Simulator::add_transient_connection)
+    const bool per_record =
+        simple_parse_with_default<bool>(node, "connection_per_record", false);
+    std::optional<TimeNs> transient_time_wait;
+    if (per_record) {
+        auto time_wait_node = node["time_wait"];
+        transient_time_wait = time_wait_node
+                                  ? parse_time(time_wait_node.value())
+                                  : TimeNs(Time<Microsecond>(100));
+    }
+
+    auto connection_factory = [template_node = connection_node.get_node(),
+                               prefix, per_record,
+                               records_count = std::size_t(0)](
+                                  const Id& source,
+                                  const Id& destination) mutable {
+        auto& factory = IdentifierFactory::get_instance();
+        for (const Id& host : {source, destination}) {
+            if (factory.get_object<IHost>(host) == nullptr) {
+                throw std::runtime_error(fmt::format(
+                    "Trace refers to unknown host {}", host));
+            }
+        }
+        YAML::Node connection = YAML::Clone(template_node);
+        connection["sender_id"] = source;
+        connection["receiver_id"] = destination;
+        Id id = fmt::format("{}_{}_{}", prefix, source, destination);
+        if (per_record) {
+            id += fmt::format("_{}", ++records_count);
+        }
+        return ConnectionParser::parse_i_connection(
+            ConfigNode(connection, std::move(id)));
+    };
+
+    return std::make_unique<TraceReplayAction>(
+        trace_path, std::move(connection_factory), transient_time_wait);
+}
+
+}  // namespace sim
@@ -1,19 +1,22 @@
 #include "scenario_parser.hpp"
 
 #include "action/action_parser.hpp"
+#include "parser/config_reader/range_expansion.hpp"
 
 namespace sim {
 
-Scenario ScenarioParser::parse(const ConfigNode& scenario_node) {
+Scenario ScenarioParser::parse(const ConfigNode& scenario_node,
+                               const std::filesystem::path& config_dir) {
     if (!scenario_node.IsSequence()) {
         throw scenario_node.create_parsing_error("Node should be a sequence");
     }
 
     auto scenario = Scenario();
 
-    for (const auto& node : scenario_node) {
-        scenario.add_action(ActionParser::parse(node));
-    }
+    for_each_expanded_element(
+        scenario_node, [&scenario, &config_dir](const ConfigNode& node) {
+            scenario.add_action(ActionParser::parse(node, config_dir));
+        });
     return scenario;
 }
 
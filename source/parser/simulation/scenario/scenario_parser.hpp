@@ -1,5 +1,6 @@
 #pragma once
 
+#include <filesystem>
 #include <memory>
 
 #include "parser/config_reader/config_node.hpp"
@@ -9,7 +10,9 @@ namespace sim {
 
 class ScenarioParser {
 public:
-    static Scenario parse(const ConfigNode& scenario_node);
+    // Relative paths in actions (e.g. traces) are relative to config_dir
+    static Scenario parse(const ConfigNode& scenario_node,
+                          const std::filesystem::path& config_dir = {});
 };
 
 }  // namespace sim
@@ -0,0 +1,365 @@
+#include "topology_generator.hpp"
+
+#include "parser/parse_utils.hpp"
+#include "parser/topology/host/host_parser.hpp"
+#include "parser/topology/switch/switch_parser.hpp"
+
+namespace sim {
+
+void TopologyGenerator::generate(const ConfigNode& generator_node,
+                                 const LinkPresets& link_presets,
+                                 const ConfigNode& packet_spraying_node,
+                                 Simulator& simulator) {
+    TopologyGenerator generator(generator_node, link_presets,
+                                packet_spraying_node, simulator);
+    std::string type =
+        generator_node["type"].value_or_throw().as_or_throw<std::string>();
+    if (type == "fat_tree") {
+        generator.generate_fat_tree();
+    } else if (type == "fractal") {
+        generator.generate_fractal();
+    } else if (type == "leaf_spine") {
+        generator.generate_leaf_spine();
+    } else if (type == "dragonfly") {
+        generator.generate_dragonfly();
+    } else {
+        throw generator_node.create_parsing_error(
+            fmt::format("Unexpected topology generator type: {}", type));
+    }
+}
+
+TopologyGenerator::TopologyGenerator(const ConfigNode& a_generator_node,
+                                     const LinkPresets& a_link_presets,
+                                     const ConfigNode& a_packet_spraying_node,
+                                     Simulator& a_simulator)
+    : m_generator_node(a_generator_node),
+      m_link_presets(a_link_presets),
+      m_packet_spraying_node(a_packet_spraying_node),
+      m_simulator(a_simulator),
+      m_next_link_num(0) {}
+
+// See scripts/generators/topology/fat_tree/fat_tree.py
+void TopologyGenerator::generate_fat_tree() {
+    std::size_t k = parse_positive("k");
+    if (k % 2 != 0) {
+        throw m_generator_node.create_parsing_error(
+            fmt::format("Fat tree k must be even, but got {}", k));
+    }
+    const std::size_t half_k = k / 2;
+    const std::size_t hosts_per_pod = half_k * half_k;
+    const std::size_t core_count = half_k * half_k;
+
+    auto host_name = [](std::size_t pod, std::size_t host) {
+        return fmt::format("pod{}_host{}", pod, host);
+    };
+    auto aggr_name = [](std::size_t pod, std::size_t aggr) {
+        return fmt::format("pod{}_aggr{}", pod, aggr);
+    };
+    auto edge_name = [](std::size_t pod, std::size_t edge) {
+        return fmt::format("pod{}_edge{}", pod, edge);
+    };
+    auto core_name = [](std::size_t core) {
+        return fmt::format("core{}", core);
+    };
+
+    for (std::size_t pod = 1; pod <= k; pod++) {
+        for (std::size_t host = 1; host <= hosts_per_pod; host++) {
+            add_host(host_name(pod, host));
+        }
+    }
+    for (std::size_t core = 1; core <= core_count; core++) {
+        add_switch(core_name(core), "core");
+    }
+    for (std::size_t pod = 1; pod <= k; pod++) {
+        for (std::size_t aggr = 1; aggr <= half_k; aggr++) {
+            add_switch(aggr_name(pod, aggr), "aggr");
+        }
+        for (std::size_t edge = 1; edge <= half_k; edge++) {
+            add_switch(edge_name(pod, edge), "edge");
+        }
+    }
+
+    for (std::size_t pod = 1; pod <= k; pod++) {
+        for (std::size_t edge = 1; edge <= half_k; edge++) {
+            for (std::size_t host = 1; host <= half_k; host++) {
+                std::size_t host_idx = (edge - 1) * half_k + host;
+                add_bidirectional_link(host_name(pod, host_idx),
+                                       edge_name(pod, edge), "edge-host");
+            }
+        }
+    }
+    for (std::size_t pod = 1; pod <= k; pod++) {
+        for (std::size_t edge = 1; edge <= half_k; edge++) {
+            for (std::size_t aggr = 1; aggr <= half_k; aggr++) {
+                add_bidirectional_link(edge_name(pod, edge),
+                                       aggr_name(pod, aggr), "aggr-edge");
+            }
+        }
+    }
+    for (std::size_t pod = 1; pod <= k; pod++) {
+        for (std::size_t aggr = 1; aggr <= half_k; aggr++) {
+            std::size_t core_offset = (aggr - 1) * half_k;
+            for (std::size_t core = 1; core <= half_k; core++) {
+                add_bidirectional_link(aggr_name(pod, aggr),
+                                       core_name(core_offset + core),
+                                       "aggr-core");
+            }
+        }
+    }
+}
+
+// See scripts/generators/topology/fractal/README.md
+void TopologyGenerator::generate_fractal() {
+    std::size_t switches_per_device =
+        parse_positive("num_switches_per_device");
+    std::size_t depth = parse_positive("depth");
+    std::size_t receivers_count =
+        simple_parse_with_default<std::size_t>(m_generator_node,
+                                               "receivers_count", 1);
+    if (receivers_count == 0) {
+        throw m_generator_node.create_parsing_error(
+            "Field receivers_count must be positive");
+    }
+
+    const Id sender = "sender";
+    std::vector<Id> receivers;
+    if (receivers_count == 1) {
+        receivers.emplace_back("receiver");
+    } else {
+        for (std::size_t i = 1; i <= receivers_count; i++) {
+            receivers.emplace_back(fmt::format("receiver-{}", i));
+        }
+    }
+    add_host(sender);
+    for (const Id& receiver : receivers) {
+        add_host(receiver);
+    }
+
+    std::vector<Id> prev_layer = {sender};
+    std::string link_layer = "sender-switch";
+    for (std::size_t layer = 0; layer < depth; layer++) {
+        std::vector<Id> current_layer;
+        for (const Id& prev : prev_layer) {
+            for (std::size_t i = 1; i <= switches_per_device; i++) {
+                Id switch_id = (layer == 0 ? fmt::format("switch-{}", i)
+                                           : fmt::format("{}-{}", prev, i));
+                add_switch(switch_id, "switch");
+                add_bidirectional_link(prev, switch_id, link_layer);
+                current_layer.push_back(std::move(switch_id));
+            }
+        }
+        prev_layer = std::move(current_layer);
+        link_layer = "switch-switch";
+    }
+
+    for (const Id& last : prev_layer) {
+        for (const Id& receiver : receivers) {
+            add_bidirectional_link(last, receiver, "switch-receiver");
+        }
+    }
+}
+
+void TopologyGenerator::generate_leaf_spine() {
+    std::size_t spines = parse_positive("spines");
+    std::size_t leaves = parse_positive("leaves");
+    std::size_t hosts_per_leaf = parse_positive("hosts_per_leaf");
+
+    auto spine_name = [](std::size_t spine) {
+        return fmt::format("spine{}", spine);
+    };
+    auto leaf_name = [](std::size_t leaf) {
+        return fmt::format("leaf{}", leaf);
+    };
+    auto host_name = [](std::size_t leaf, std::size_t host) {
+        return fmt::format("leaf{}_host{}", leaf, host);
+    };
+
+    for (std::size_t spine = 1; spine <= spines; spine++) {
+        add_switch(spine_name(spine), "spine");
+    }
+    for (std::size_t leaf = 1; leaf <= leaves; leaf++) {
+        add_switch(leaf_name(leaf), "leaf");
+        for (std::size_t host = 1; host <= hosts_per_leaf; host++) {
+            add_host(host_name(leaf, host));
+        }
+    }
+
+    for (std::size_t leaf = 1; leaf <= leaves; leaf++) {
+        for (std::size_t host = 1; host <= hosts_per_leaf; host++) {
+            add_bidirectional_link(host_name(leaf, host), leaf_name(leaf),
+                                   "leaf-host");
+        }
+    }
+    for (std::size_t leaf = 1; leaf <= leaves; leaf++) {
+        for (std::size_t spine = 1; spine <= spines; spine++) {
+            add_bidirectional_link(leaf_name(leaf), spine_name(spine),
+                                   "spine-leaf");
+        }
+    }
+}
+
+// Groups of routers connected all-to-all inside group; every pair of groups
+// is connected by one global link. Global ports of a group are numbered
+// router by router, and port d of group g leads to group g + d + 1 (modulo
+// groups count), like in balanced dragonfly (Kim et al., 2008)
+void TopologyGenerator::generate_dragonfly() {
+    std::size_t routers_per_group = parse_positive("routers_per_group");
+    std::size_t hosts_per_router = parse_positive("hosts_per_router");
+    std::size_t global_links_per_router =
+        parse_positive("global_links_per_router");
+    const std::size_t global_ports =
+        routers_per_group * global_links_per_router;
+    std::size_t groups = simple_parse_with_default<std::size_t>(
+        m_generator_node, "groups", global_ports + 1);
+    if (groups < 2 || groups > global_ports + 1) {
+        throw m_generator_node.create_parsing_error(fmt::format(
+            "Dragonfly groups count must be in [2, {}], but got {}",
+            global_ports + 1, groups));
+    }
+
+    auto router_name = [](std::size_t group, std::size_t router) {
+        return fmt::format("group{}_router{}", group, router);
+    };
+    auto host_name = [](std::size_t group, std::size_t router,
+                        std::size_t host) {
+        return fmt::format("group{}_router{}_host{}", group, router, host);
+    };
+
+    for (std::size_t group = 1; group <= groups; group++) {
+        for (std::size_t router = 1; router <= routers_per_group; router++) {
+            add_switch(router_name(group, router), "router");
+            for (std::size_t host = 1; host <= hosts_per_router; host++) {
+                add_host(host_name(group, router, host));
+            }
+        }
+    }
+
+    for (std::size_t group = 1; group <= groups; group++) {
+        for (std::size_t router = 1; router <= routers_per_group; router++) {
+            for (std::size_t host = 1; host <= hosts_per_router; host++) {
+                add_bidirectional_link(host_name(group, router, host),
+                                       router_name(group, router),
+                                       "router-host");
+            }
+        }
+    }
+    for (std::size_t group = 1; group <= groups; group++) {
+        for (std::size_t first = 1; first <= routers_per_group; first++) {
+            for (std::size_t second = first + 1; second <= routers_per_group;
+                 second++) {
+                add_bidirectional_link(router_name(group, first),
+                                       router_name(group, second), "local");
+            }
+        }
+    }
+    for (std::size_t first = 1; first <= groups; first++) {
+        for (std::size_t second = first + 1; second <= groups; second++) {
+            std::size_t first_port = second - first - 1;
+            std::size_t second_port = groups - (second - first) - 1;
+            add_bidirectional_link(
+                router_name(first, first_port / global_links_per_router + 1),
+                router_name(second,
+                            second_port / global_links_per_router + 1),
+                "global");
+        }
+    }
+}
+
+void TopologyGenerator::add_host(Id id) {
+    auto host = HostParser::parse_i_host(
+        ConfigNode(YAML::Node(YAML::NodeType::Null), std::move(id)));
+    if (auto result = m_simulator.add_host(host); !result.has_value()) {
+        throw std::runtime_error(
+            fmt::format("{}; Id: {}", result.error(), host->get_id()));
+    }
+}
+
+void TopologyGenerator::add_switch(Id id, const std::string& switch_layer) {
+    YAML::Node switch_yaml(YAML::NodeType::Map);
+    if (ConfigNodeExpected ecn_node = m_generator_node["switch_ecn"];
+        ecn_node) {
+        if (ConfigNodeExpected layer_ecn = ecn_node.value()[switch_layer];
+            layer_ecn) {
+            switch_yaml["ecn"] = layer_ecn.value().get_node();
+        }
+    }
+    auto swtch = SwitchParser::parse_i_switch(
+        ConfigNode(std::move(switch_yaml), std::move(id)),
+        m_packet_spraying_node);
+    if (auto result = m_simulator.add_switch(swtch); !result.has_value()) {
+        throw std::runtime_error(
+            fmt::format("{}; Id: {}", result.error(), swtch->get_id()));
+    }
+}
+
+void TopologyGenerator::add_bidirectional_link(const Id& first,
+                                               const Id& second,
+                                               const std::string& link_layer) {
+    const LinkInitArgs& preset = get_link_layer_preset(link_layer);
+    for (const auto& [from, to] : {std::pair(first, second),
+                                   std::pair(second, first)}) {
+        LinkInitArgs args = preset;
+        args.id = fmt::format("link_{}", m_next_link_num++);
+        args.from_id = from;
+        args.to_id = to;
+        std::shared_ptr<ILink> link;
+        try {
+            link = std::make_shared<Link>(std::move(args));
+        } catch (const std::exception& e) {
+            throw m_generator_node.create_parsing_error(
+                fmt::format("Can not create link of layer {}: {}",
+                            link_layer, e.what()));
+        }
+        if (auto result = m_simulator.add_link(link); !result.has_value()) {
+            throw std::runtime_error(
+                fmt::format("{}; Id: {}", result.error(), link->get_id()));
+        }
+    }
+}
+
+const LinkInitArgs& TopologyGenerator::get_link_layer_preset(
+    const std::string& link_layer) const {
+    auto cached = m_layer_presets.find(link_layer);
+    if (cached != m_layer_presets.end()) {
+        return cached->second;
+    }
+
+    std::string preset_name = "default";
+    if (m_link_presets.contains(link_layer)) {
+        preset_name = link_layer;
+    }
+    if (ConfigNodeExpected layers_node = m_generator_node["link_presets"];
+        layers_node) {
+        preset_name = simple_parse_with_default(layers_node.value(),
+                                                link_layer, preset_name);
+    }
+
+    LinkInitArgs preset;
+    auto it = m_link_presets.find(preset_name);
+    if (it != m_link_presets.end()) {
+        preset = it->second;
+    } else if (preset_name != "default") {
+        throw m_generator_node.create_parsing_error(
+            "Can not find preset with name " + preset_name);
+    } else {
+        LOG_WARN(
+            "Can not find default preset; use empty preset (get from "
+            "default constructor)");
+    }
+    return m_layer_presets.emplace(link_layer, std::move(preset))
+        .first->second;
+}
+
+std::size_t TopologyGenerator::parse_positive(
+    std::string_view field_name) const {
+    std::size_t value = m_generator_node[field_name]
+                            .value_or_throw()
+                            .as_or_throw<std::size_t>();
+    if (value == 0) {
+        throw m_generator_node.create_parsing_error(
+            fmt::format("Field {} must be positive", field_name));
+    }
+    return value;
+}
+
+}  // namespace sim
@@ -0,0 +1,62 @@
+#pragma once
+#include <spdlog/fmt/fmt.h>
+
+#include <string>
+
+#include "parser/config_reader/config_node.hpp"
+#include "parser/topology/link/link_parser.hpp"
+#include "simulator.hpp"
+
+namespace sim {
+
+// Builds parametric topologies (fat tree, fractal, leaf-spine, dragonfly)
+// directly in simulator, so large topologies do not need to be listed device
+// by device in config.
+// Names of devices and links of fat tree and fractal match ones produced by
+// scripts/generators/topology, so simulation configs written for generated
+// topologies keep working
+class TopologyGenerator {
+public:
+    static void generate(const ConfigNode& generator_node,
+                         const LinkPresets& link_presets,
+                         const ConfigNode& packet_spraying_node,
+                         Simulator& simulator);
+
+private:
+    TopologyGenerator(const ConfigNode& a_generator_node,
+                      const LinkPresets& a_link_presets,
+                      const ConfigNode& a_packet_spraying_node,
+                      Simulator& a_simulator);
+
+    void generate_fat_tree();
+    void generate_fractal();
+    void generate_leaf_spine();
+    void generate_dragonfly();
+
+    void add_host(Id id);
+    // switch_layer is used to find ECN settings in generator node
+    void add_switch(Id id, const std::string& switch_layer);
+    // Adds links first->second and second->first (in this order) with preset
+    // of given link layer
+    void add_bidirectional_link(const Id& first, const Id& second,
+                                const std::string& link_layer);
+
+    // Preset name for layer is taken from `link_presets` map of generator
+    // node; if it is not set, preset with same name as layer is used (if
+    // exists), default preset otherwise
+    const LinkInitArgs& get_link_layer_preset(
+        const std::string& link_layer) const;
+
+    std::size_t parse_positive(std::string_view field_name) const;
+
+    const ConfigNode& m_generator_node;
+    const LinkPresets& m_link_presets;
+    const ConfigNode& m_packet_spraying_node;
+    Simulator& m_simulator;
+
+    std::size_t m_next_link_num;
+    // Cache of layer presets as there are few layers and many links
+    mutable std::unordered_map<std::string, LinkInitArgs> m_layer_presets;
+};
+
+}  // namespace sim
@@ -1,5 +1,7 @@
 #include "link_parser.hpp"
 
+#include "parser/config_reader/range_expansion.hpp"
+
 namespace sim {
 
 std::shared_ptr<ILink> LinkParser::parse_i_link(const ConfigNode& link_node,
@@ -37,6 +39,67 @@ void LinkParser::parse_to_args(const ConfigNode& node, LinkInitArgs& args) {
         });
 }
 
+void LinkParser::for_each_link_node(
+    const ConfigNode& link_node,
+    const std::function<void(const ConfigNode&)>& func) {
+    ConfigNodeExpected connect_node = link_node["connect"];
+    if (!connect_node) {
+        func(link_node);
+        return;
+    }
+    std::string connect = connect_node.value().as_or_throw<std::string>();
+
+    bool bidirectional = true;
+    std::size_t arrow = connect.find("<->");
+    std::size_t arrow_size = 3;
+    if (arrow == std::string::npos) {
+        bidirectional = false;
+        arrow = connect.find("->");
+        arrow_size = 2;
+    }
+    if (arrow == std::string::npos) {
+        throw connect_node.value().create_parsing_error(
+            "Expected <devices> -> <devices> or <devices> <-> <devices>");
+    }
+    auto trim = [](std::string text) {
+        text.erase(0, text.find_first_not_of(' '));
+        text.erase(text.find_last_not_of(' ') + 1);
+        return text;
+    };
+    std::vector<std::string> sources, destinations;
+    try {
+        sources = expand_names(trim(connect.substr(0, arrow)));
+        destinations = expand_names(trim(connect.substr(arrow + arrow_size)));
+    } catch (const std::runtime_error& e) {
+        throw connect_node.value().create_parsing_error(e.what());
+    }
+
+    // Rest of the fields (preset name, latency etc) are common for all links
+    YAML::Node common(YAML::NodeType::Map);
+    for (const auto& field : link_node.get_node()) {
+        if (field.first.Scalar() != "connect") {
+            common[field.first.Scalar()] = field.second;
+        }
+    }
+
+    const Id& name = link_node.get_name_or_throw();
+    std::size_t link_num = 0;
+    auto add_link = [&](const Id& from, const Id& to) {
+        YAML::Node link = YAML::Clone(common);
+        link["from"] = from;
+        link["to"] = to;
+        func(ConfigNode(link, fmt::format("{}_{}", name, link_num++)));
+    };
+    for (const Id& source : sources) {
+        for (const Id& destination : destinations) {
+            add_link(source, destination);
+            if (bidirectional) {
+                add_link(destination, source);
+            }
+        }
+    }
+}
+
 std::shared_ptr<Link> LinkParser::parse_default_link(
     const ConfigNode& link_node, const LinkPresets& presets) {
     Id link_id = link_node.get_name_or_throw();
@@ -12,6 +12,15 @@ public:
                                                const LinkPresets& presets);
     static void parse_to_args(const ConfigNode& node, LinkInitArgs& args);
 
+    // Calls func for link_node itself or, if it has field
+    // `connect: <devices> -> <devices>` (or `<->` for links in both
+    // directions), for every link it describes. Devices may be given as
+    // ranged names; links are created between all pairs of them and named
+    // <link_node name>_<number>
+    static void for_each_link_node(
+        const ConfigNode& link_node,
+        const std::function<void(const ConfigNode&)>& func);
+
 private:
     static std::shared_ptr<Link> parse_default_link(const ConfigNode& link_node,
                                                     const LinkPresets& presets);
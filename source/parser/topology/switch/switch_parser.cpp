@@ -7,6 +7,7 @@
 #include "device/hashers/salt_ecmp_hasher.hpp"
 #include "device/hashers/symmetric_hasher.hpp"
 #include "parser/parse_utils.hpp"
+#include "utils/hash.hpp"
 
 namespace sim {
 
@@ -21,18 +22,18 @@ std::shared_ptr<Switch> SwitchParser::parse_default_switch(
     ConfigNodeExpected ecn_node = switch_node["ecn"];
     ECN ecn(1.0, 1.0, 0.0);
     if (ecn_node) {
-        ecn = parse_ecn(ecn_node.value());
+        ecn = parse_ecn(ecn_node.value(), id);
     }
     return std::make_shared<Switch>(id, std::move(ecn),
                                     parse_hasher(packet_spraying_node, id));
 }
 
-ECN SwitchParser::parse_ecn(const ConfigNode& node) {
+ECN SwitchParser::parse_ecn(const ConfigNode& node, const Id& switch_id) {
     float min = node["min"].value_or_throw().as_or_throw<float>();
     float max = node["max"].value_or_throw().as_or_throw<float>();
     float probability =
         node["probability"].value_or_throw().as_or_throw<float>();
-    return ECN(min, max, probability);
+    return ECN(min, max, probability, utils::hash_string(switch_id));
 }
 
 std::unique_ptr<IPacketHasher> SwitchParser::parse_hasher(
@@ -42,7 +43,7 @@ std::unique_ptr<IPacketHasher> SwitchParser::parse_hasher(
                            .as<std::string>()
                            .value_or_throw();
     if (type == "random") {
-        return std::make_unique<RandomHasher>();
+        return std::make_unique<RandomHasher>(switch_id);
     }
     if (type == "ecmp") {
         return std::make_unique<ECMPHasher>();
@@ -50,16 +51,14 @@ std::unique_ptr<IPacketHasher> SwitchParser::parse_hasher(
     if (type == "flowlet") {
         TimeNs threshold =
             parse_time(packet_spraying_node["threshold"].value_or_throw());
-        return std::make_unique<FLowletHasher>(threshold);
+        return std::make_unique<FLowletHasher>(
+            threshold, parse_flowlet_table(packet_spraying_node, switch_id));
     }
     if (type == "adaptive_flowlet") {
-        auto factor_node = packet_spraying_node["factor"];
-        if (factor_node) {
-            double factor = factor_node.value().as_or_throw<double>();
-            return std::make_unique<AdaptiveFlowletHasher>(factor);
-        } else {
-            return std::make_unique<AdaptiveFlowletHasher>();
-        }
+        double factor =
+            simple_parse_with_default(packet_spraying_node, "factor", 0.5);
+        return std::make_unique<AdaptiveFlowletHasher>(
+            factor, parse_flowlet_table(packet_spraying_node, switch_id));
     }
     if (type == "salt") {
         return std::make_unique<SaltECMPHasher>(std::move(switch_id));
@@ -68,4 +67,23 @@ std::unique_ptr<IPacketHasher> SwitchParser::parse_hasher(
         fmt::format("Unexpected packet sprayng type: {}", type));
 }
 
+FlowletTable SwitchParser::parse_flowlet_table(
+    const ConfigNode& packet_spraying_node, Id switch_id) {
+    std::size_t size = simple_parse_with_default<std::size_t>(
+        packet_spraying_node, "table_size", FlowletTable::M_DEFAULT_SIZE);
+    if (size == 0) {
+        throw packet_spraying_node.create_parsing_error(
+            "Flowlet table size should be positive");
+    }
+    std::optional<TimeNs> aging_time = FlowletTable::M_DEFAULT_AGING_TIME;
+    if (auto aging_node = packet_spraying_node["aging_time"]; aging_node) {
+        if (aging_node->as<std::string>() == "none") {
+            aging_time = std::nullopt;
+        } else {
+            aging_time = parse_time(aging_node.value());
+        }
+    }
+    return FlowletTable(std::move(switch_id), size, aging_time);
+}
+
 }  // namespace sim
@@ -3,6 +3,7 @@
 
 #include <memory>
 
+#include "device/hashers/flowlet_table.hpp"
 #include "device/switch.hpp"
 #include "parser/config_reader/config_node.hpp"
 
@@ -17,10 +18,13 @@ private:
     static std::shared_ptr<Switch> parse_default_switch(
         const ConfigNode& switch_node, const ConfigNode& packet_spraying_node);
 
-    static ECN parse_ecn(const ConfigNode& node);
+    static ECN parse_ecn(const ConfigNode& node, const Id& switch_id);
 
     static std::unique_ptr<IPacketHasher> parse_hasher(
         const ConfigNode& packet_spraying_node, Id switch_id);
+
+    static FlowletTable parse_flowlet_table(
+        const ConfigNode& packet_spraying_node, Id switch_id);
 };
 
 }  // namespace sim
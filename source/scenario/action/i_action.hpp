@@ -1,12 +1,27 @@
 #pragma once
+#include <cstddef>
 #include <memory>
 
 namespace sim {
 
+class Simulator;
+
 class IAction {
 public:
     virtual ~IAction() = default;
-    virtual void schedule() = 0;
+    // Simulator is given to actions that add objects to it during simulation
+    // (e.g. connections created by trace replay)
+    virtual void schedule(Simulator& simulator) = 0;
+};
+
+// Action performed in steps: schedule adds only the first step and every
+// step adds the next one, so scheduler keeps O(1) events per action instead
+// of all its occurrences
+class ISteppedAction : public IAction {
+public:
+    // stream distinguishes independent sequences of steps of the action
+    // (e.g. one per connection)
+    virtual void step(std::size_t stream) = 0;
 };
 
 }  // namespace sim
@@ -0,0 +1,60 @@
+#include "on_off_action.hpp"
+
+#include "event/action_step.hpp"
+#include "logger/logger.hpp"
+#include "scheduler.hpp"
+
+namespace sim {
+
+OnOffAction::OnOffAction(TimeNs a_start, TimeNs a_on_duration,
+                         TimeNs a_off_duration, TimeNs a_interval,
+                         std::size_t a_bursts_count,
+                         SizeDistribution a_size_distribution,
+                         std::vector<std::weak_ptr<IConnection>> a_conns,
+                         std::uint64_t a_seed)
+    : m_start(a_start),
+      m_on_duration(a_on_duration),
+      m_off_duration(a_off_duration),
+      m_interval(a_interval),
+      m_bursts_count(a_bursts_count),
+      m_size_distribution(std::move(a_size_distribution)),
+      m_conns(std::move(a_conns)),
+      m_rng(a_seed) {
+    if (!(m_interval > TimeNs(0))) {
+        throw std::invalid_argument(
+            "On/off action interval should be positive");
+    }
+}
+
+void OnOffAction::schedule(Simulator&) { schedule_next(); }
+
+void OnOffAction::step(std::size_t) {
+    for (auto& weak : m_conns) {
+        auto connection = weak.lock();
+        if (connection == nullptr) {
+            LOG_ERROR("Connection expired; can't add data to it");
+            continue;
+        }
+        connection->add_data_to_send(m_size_distribution.sample(m_rng));
+    }
+    m_step_in_burst++;
+    schedule_next();
+}
+
+void OnOffAction::schedule_next() {
+    // Steps of burst happen at interval multiples strictly inside on period
+    // (the first one happens even if on period is empty)
+    if (m_step_in_burst > 0 &&
+        !(m_step_in_burst * m_interval < m_on_duration)) {
+        m_burst++;
+        m_step_in_burst = 0;
+    }
+    if (m_burst >= m_bursts_count) {
+        return;
+    }
+    TimeNs time = m_start + m_burst * (m_on_duration + m_off_duration) +
+                  m_step_in_burst * m_interval;
+    Scheduler::get_instance().add<ActionStep>(time, this, 0);
+}
+
+}  // namespace sim
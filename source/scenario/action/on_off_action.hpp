@@ -0,0 +1,42 @@
+#pragma once
+#include "connection/i_connection.hpp"
+#include "i_action.hpp"
+#include "size_distribution.hpp"
+#include "types.hpp"
+#include "utils/random_stream.hpp"
+
+namespace sim {
+
+// Synchronized bursts: during every on period (on_duration long) each
+// connection gets data of sampled size every interval; on periods are
+// separated by off periods (off_duration long) and repeated
+// bursts_count times. Only the next step is kept in scheduler
+class OnOffAction : public ISteppedAction {
+public:
+    OnOffAction(TimeNs a_start, TimeNs a_on_duration, TimeNs a_off_duration,
+                TimeNs a_interval, std::size_t a_bursts_count,
+                SizeDistribution a_size_distribution,
+                std::vector<std::weak_ptr<IConnection>> a_conns,
+                std::uint64_t a_seed);
+
+    void schedule(Simulator& simulator) final;
+    void step(std::size_t stream) final;
+
+private:
+    void schedule_next();
+
+    TimeNs m_start;
+    TimeNs m_on_duration;
+    TimeNs m_off_duration;
+    TimeNs m_interval;
+    std::size_t m_bursts_count;
+    SizeDistribution m_size_distribution;
+    std::vector<std::weak_ptr<IConnection>> m_conns;
+    RandomStream m_rng;
+
+    // Position of the next step
+    std::size_t m_burst = 0;
+    std::size_t m_step_in_burst = 0;
+};
+
+}  // namespace sim
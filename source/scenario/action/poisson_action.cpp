@@ -0,0 +1,56 @@
+#include "poisson_action.hpp"
+
+#include "event/action_step.hpp"
+#include "logger/logger.hpp"
+#include "scheduler.hpp"
+
+namespace sim {
+
+PoissonAction::PoissonAction(TimeNs a_start, TimeNs a_mean_interval,
+                             std::optional<TimeNs> a_until,
+                             std::optional<std::size_t> a_count,
+                             SizeDistribution a_size_distribution,
+                             std::vector<std::weak_ptr<IConnection>> a_conns,
+                             std::uint64_t a_seed)
+    : m_next_time(a_start),
+      m_until(a_until),
+      m_count(a_count),
+      m_size_distribution(std::move(a_size_distribution)),
+      m_conns(std::move(a_conns)),
+      m_rng(a_seed),
+      m_mean_interval_ns(a_mean_interval.value_nanoseconds()) {
+    if (m_conns.empty()) {
+        throw std::invalid_argument("Poisson action without connections");
+    }
+}
+
+void PoissonAction::schedule(Simulator&) {
+    // First arrival also happens after exponential interval since start
+    schedule_next();
+}
+
+void PoissonAction::step(std::size_t) {
+    m_arrivals_count++;
+    std::size_t conn_index = m_rng.next_below(m_conns.size());
+    SizeByte size = m_size_distribution.sample(m_rng);
+    auto connection = m_conns[conn_index].lock();
+    if (connection == nullptr) {
+        LOG_ERROR("Connection expired; can't add data to it");
+    } else {
+        connection->add_data_to_send(size);
+    }
+    schedule_next();
+}
+
+void PoissonAction::schedule_next() {
+    if (m_count.has_value() && m_arrivals_count >= m_count.value()) {
+        return;
+    }
+    m_next_time += TimeNs(m_rng.next_exponential(m_mean_interval_ns));
+    if (m_until.has_value() && m_next_time > m_until.value()) {
+        return;
+    }
+    Scheduler::get_instance().add<ActionStep>(m_next_time, this, 0);
+}
+
+}  // namespace sim
@@ -0,0 +1,44 @@
+#pragma once
+#include <optional>
+
+#include "connection/i_connection.hpp"
+#include "i_action.hpp"
+#include "size_distribution.hpp"
+#include "types.hpp"
+#include "utils/random_stream.hpp"
+
+namespace sim {
+
+// Open-loop workload: data arrives as Poisson process (intervals between
+// arrivals are exponential with given mean), every arrival adds data of size
+// sampled from distribution to connection chosen uniformly at random.
+// Only the next arrival is kept in scheduler, so memory does not depend on
+// number of arrivals
+class PoissonAction : public ISteppedAction {
+public:
+    // Arrivals stop after `until` time or `count` arrivals, whichever is
+    // earlier
+    PoissonAction(TimeNs a_start, TimeNs a_mean_interval,
+                  std::optional<TimeNs> a_until,
+                  std::optional<std::size_t> a_count,
+                  SizeDistribution a_size_distribution,
+                  std::vector<std::weak_ptr<IConnection>> a_conns,
+                  std::uint64_t a_seed);
+
+    void schedule(Simulator& simulator) final;
+    void step(std::size_t stream) final;
+
+private:
+    void schedule_next();
+
+    TimeNs m_next_time;
+    std::optional<TimeNs> m_until;
+    std::optional<std::size_t> m_count;
+    SizeDistribution m_size_distribution;
+    std::vector<std::weak_ptr<IConnection>> m_conns;
+    RandomStream m_rng;
+    double m_mean_interval_ns;
+    std::size_t m_arrivals_count = 0;
+};
+
+}  // namespace sim
@@ -1,6 +1,8 @@
 #include "send_data_action.hpp"
 
-#include "event/add_data_to_connection.hpp"
+#include "event/action_step.hpp"
+#include "logger/logger.hpp"
+#include "utils/hash.hpp"
 
 namespace sim {
 
@@ -15,24 +17,49 @@ SendDataAction::SendDataAction(TimeNs a_when, SizeByte a_size,
       m_repeat_interval(a_repeat_interval),
       m_jitter(a_jitter) {}
 
-void SendDataAction::schedule() {
-    const bool use_jitter = m_jitter > TimeNs(0);
-
+void SendDataAction::schedule(Simulator&) {
+    m_states.clear();
+    m_states.reserve(m_conns.size());
     for (auto& weak : m_conns) {
         auto conn = weak.lock();
         if (!conn) throw std::runtime_error("Expired connection in action");
 
-        std::uint64_t seed = std::hash<std::string>{}(conn->get_id());
-        std::mt19937_64 rng(seed);
-        std::uniform_int_distribution<uint64_t> dist(
-            0, m_jitter.value_nanoseconds());
+        m_states.push_back(ConnectionState{
+            conn, RandomStream(utils::hash_string(conn->get_id())), 0});
+    }
+    for (std::size_t stream = 0; stream < m_states.size(); stream++) {
+        schedule_next(stream);
+    }
+}
+
+void SendDataAction::step(std::size_t stream) {
+    ConnectionState& state = m_states[stream];
+    auto connection = state.connection.lock();
+    if (connection == nullptr) {
+        LOG_ERROR("Connection expired; can't add data to it");
+        return;
+    }
+    connection->add_data_to_send(m_size);
+    state.sent_count++;
+    schedule_next(stream);
+}
 
-        for (size_t i = 0; i < m_repeat_count; ++i) {
-            TimeNs jitter_gap = use_jitter ? TimeNs(dist(rng)) : TimeNs(0);
-            Scheduler::get_instance().add<AddDataToConnection>(
-                m_when + i * m_repeat_interval + jitter_gap, conn, m_size);
-        }
+void SendDataAction::schedule_next(std::size_t stream) {
+    ConnectionState& state = m_states[stream];
+    if (state.sent_count >= m_repeat_count) {
+        return;
+    }
+    // Jitters are drawn in same order as if all occurrences were scheduled at
+    // once, so lazy scheduling does not change times
+    TimeNs jitter_gap(0);
+    if (m_jitter > TimeNs(0)) {
+        // Jitter bound is inclusive
+        std::uint64_t max_jitter_ns = m_jitter.value_nanoseconds();
+        jitter_gap = TimeNs(state.rng.next_below(max_jitter_ns + 1));
     }
+    Scheduler::get_instance().add<ActionStep>(
+        m_when + state.sent_count * m_repeat_interval + jitter_gap, this,
+        stream);
 }
 
 }  // namespace sim
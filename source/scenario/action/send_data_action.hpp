@@ -1,29 +1,40 @@
 #pragma once
-#include <random>
 
 #include "connection/i_connection.hpp"
 #include "i_action.hpp"
 #include "scheduler.hpp"
 #include "types.hpp"
+#include "utils/random_stream.hpp"
 
 namespace sim {
 
-class SendDataAction : public IAction {
+class SendDataAction : public ISteppedAction {
 public:
     SendDataAction(TimeNs a_when, SizeByte a_size,
                    std::vector<std::weak_ptr<IConnection>> a_conns,
                    int a_repeat_count, TimeNs a_repeat_interval,
                    TimeNs a_jitter);
 
-    void schedule() final;
+    void schedule(Simulator& simulator) final;
+    // Stream is index of connection
+    void step(std::size_t stream) final;
 
 private:
+    struct ConnectionState {
+        std::weak_ptr<IConnection> connection;
+        RandomStream rng;
+        size_t sent_count = 0;
+    };
+
+    void schedule_next(std::size_t stream);
+
     TimeNs m_when;
     SizeByte m_size;
     std::vector<std::weak_ptr<IConnection>> m_conns;
     size_t m_repeat_count;
     TimeNs m_repeat_interval;
     TimeNs m_jitter;
+    std::vector<ConnectionState> m_states;
 };
 
 }  // namespace sim
@@ -0,0 +1,80 @@
+#include "size_distribution.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace sim {
+
+SizeDistribution::SizeDistribution(std::vector<Point> a_cdf)
+    : m_cdf(std::move(a_cdf)) {
+    if (m_cdf.empty()) {
+        throw std::invalid_argument("CDF should contain at least one point");
+    }
+    for (std::size_t i = 0; i < m_cdf.size(); i++) {
+        const Point& point = m_cdf[i];
+        if (point.probability < 0 || point.probability > 1) {
+            throw std::invalid_argument("CDF probability should be in [0, 1]");
+        }
+        if (i > 0 && (point.size < m_cdf[i - 1].size ||
+                      point.probability < m_cdf[i - 1].probability)) {
+            throw std::invalid_argument(
+                "CDF points should be sorted by size and probability");
+        }
+    }
+    if (m_cdf.back().probability != 1) {
+        throw std::invalid_argument(
+            "Probability of the last CDF point should be 1");
+    }
+}
+
+SizeDistribution SizeDistribution::constant(SizeByte size) {
+    return SizeDistribution({Point{size, 1}});
+}
+
+SizeDistribution SizeDistribution::websearch() {
+    return SizeDistribution({{SizeByte(0), 0},
+                             {SizeByte(10'000), 0.15},
+                             {SizeByte(20'000), 0.2},
+                             {SizeByte(30'000), 0.3},
+                             {SizeByte(50'000), 0.4},
+                             {SizeByte(80'000), 0.53},
+                             {SizeByte(200'000), 0.6},
+                             {SizeByte(1'000'000), 0.7},
+                             {SizeByte(2'000'000), 0.8},
+                             {SizeByte(5'000'000), 0.9},
+                             {SizeByte(10'000'000), 0.97},
+                             {SizeByte(30'000'000), 1}});
+}
+
+SizeByte SizeDistribution::sample(RandomStream& random) const {
+    double probability = random.next_double();
+    auto next = std::lower_bound(m_cdf.begin(), m_cdf.end(), probability,
+                                 [](const Point& point, double value) {
+                                     return point.probability < value;
+                                 });
+    if (next == m_cdf.begin()) {
+        return next->size;
+    }
+    auto prev = std::prev(next);
+    double fraction = (probability - prev->probability) /
+                      (next->probability - prev->probability);
+    double size = prev->size.value() +
+                  fraction * (next->size.value() - prev->size.value());
+    // Zero-sized data can not be sent
+    return SizeByte(
+        static_cast<std::uint64_t>(std::max(1.0, std::round(size))));
+}
+
+SizeByte SizeDistribution::mean() const {
+    // Size is uniform between neighbour points, so every segment adds its
+    // probability times mean of its ends
+    double mean = m_cdf.front().size.value() * m_cdf.front().probability;
+    for (std::size_t i = 1; i < m_cdf.size(); i++) {
+        mean += (m_cdf[i].probability - m_cdf[i - 1].probability) *
+                (m_cdf[i].size.value() + m_cdf[i - 1].size.value()) / 2;
+    }
+    return SizeByte(static_cast<std::uint64_t>(std::round(mean)));
+}
+
+}  // namespace sim
@@ -0,0 +1,34 @@
+#pragma once
+#include <vector>
+
+#include "types.hpp"
+#include "utils/random_stream.hpp"
+
+namespace sim {
+
+// Distribution of data sizes given by points of empirical CDF. Sizes between
+// points are interpolated linearly, as in workload files of datacenter
+// simulators (e.g. WebSearch_distribution.txt of HPCC)
+class SizeDistribution {
+public:
+    struct Point {
+        SizeByte size;
+        double probability;
+    };
+
+    // Points should be sorted by size and probability, probability of the
+    // last one should be 1. Throws std::invalid_argument otherwise
+    explicit SizeDistribution(std::vector<Point> a_cdf);
+
+    static SizeDistribution constant(SizeByte size);
+    // Web search workload from DCTCP paper; mean is about 1.6MB
+    static SizeDistribution websearch();
+
+    SizeByte sample(RandomStream& random) const;
+    SizeByte mean() const;
+
+private:
+    std::vector<Point> m_cdf;
+};
+
+}  // namespace sim
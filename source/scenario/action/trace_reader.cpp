@@ -0,0 +1,132 @@
+#include "trace_reader.hpp"
+
+#include <fcntl.h>
+#include <spdlog/fmt/fmt.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+
+namespace sim {
+
+// Read part of mapping is released by chunks of this size
+static constexpr std::size_t RELEASE_CHUNK_SIZE = 64 * 1024 * 1024;
+
+TraceReader::TraceReader(const std::filesystem::path& path)
+    : m_path(path),
+      m_data(nullptr),
+      m_size(0),
+      m_position(0),
+      m_released(0),
+      m_line_number(0) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        throw std::runtime_error(fmt::format("Can not open trace {}: {}",
+                                             path.string(),
+                                             std::strerror(errno)));
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) == -1) {
+        close(fd);
+        throw std::runtime_error(
+            fmt::format("Can not read trace {}", path.string()));
+    }
+    m_size = file_stat.st_size;
+    if (m_size > 0) {
+        void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            close(fd);
+            throw std::runtime_error(
+                fmt::format("Can not map trace {}", path.string()));
+        }
+        m_data = static_cast<char*>(data);
+        madvise(m_data, m_size, MADV_SEQUENTIAL);
+    }
+    close(fd);
+}
+
+TraceReader::~TraceReader() {
+    if (m_data != nullptr) {
+        munmap(m_data, m_size);
+    }
+}
+
+std::optional<TraceReader::Record> TraceReader::next() {
+    while (m_position < m_size) {
+        const char* line_start = m_data + m_position;
+        const char* line_end = static_cast<const char*>(
+            std::memchr(line_start, '\n', m_size - m_position));
+        std::size_t line_size =
+            (line_end == nullptr ? m_size - m_position
+                                 : line_end - line_start);
+        release_read_pages(m_position);
+        m_position += line_size + 1;
+        m_line_number++;
+
+        std::string_view line(line_start, line_size);
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        if (line.empty()) {
+            continue;
+        }
+        std::optional<Record> record = parse_line(line);
+        if (record.has_value()) {
+            return record;
+        }
+        // Header is allowed only as the first line
+        if (m_line_number != 1) {
+            throw std::runtime_error(
+                fmt::format("Malformed line {} of trace {}: `{}`; expected "
+                            "<time ns>,<source>,<destination>,<size bytes>",
+                            m_line_number, m_path.string(), line));
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<TraceReader::Record> TraceReader::parse_line(
+    std::string_view line) const {
+    std::array<std::string_view, 4> fields;
+    std::size_t field_start = 0;
+    for (std::size_t i = 0; i < fields.size(); i++) {
+        std::size_t field_end = line.find(',', field_start);
+        if ((field_end == std::string_view::npos) != (i + 1 == fields.size())) {
+            return std::nullopt;
+        }
+        fields[i] = line.substr(field_start, field_end - field_start);
+        field_start = field_end + 1;
+    }
+
+    double time = 0;
+    auto time_result = std::from_chars(
+        fields[0].data(), fields[0].data() + fields[0].size(), time);
+    std::uint64_t size = 0;
+    auto size_result = std::from_chars(
+        fields[3].data(), fields[3].data() + fields[3].size(), size);
+    bool correct = time_result.ec == std::errc() &&
+                   time_result.ptr == fields[0].data() + fields[0].size() &&
+                   size_result.ec == std::errc() &&
+                   size_result.ptr == fields[3].data() + fields[3].size() &&
+                   !fields[1].empty() && !fields[2].empty() && size > 0;
+    if (!correct) {
+        return std::nullopt;
+    }
+    return Record{TimeNs(time), fields[1], fields[2], SizeByte(size)};
+}
+
+void TraceReader::release_read_pages(std::size_t keep_from) {
+    if (keep_from - m_released < RELEASE_CHUNK_SIZE) {
+        return;
+    }
+    std::size_t page_size = sysconf(_SC_PAGESIZE);
+    std::size_t release_end = keep_from / page_size * page_size;
+    madvise(m_data + m_released, release_end - m_released, MADV_DONTNEED);
+    m_released = release_end;
+}
+
+}  // namespace sim
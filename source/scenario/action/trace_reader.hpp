@@ -0,0 +1,49 @@
+#pragma once
+#include <filesystem>
+#include <optional>
+#include <string_view>
+
+#include "types.hpp"
+
+namespace sim {
+
+// Streaming reader of flow traces in CSV format; every line is
+// `<start time in ns>,<source host>,<destination host>,<size in bytes>`,
+// the first line may be a header. File is memory mapped and read
+// sequentially; pages behind current position are released, so memory does
+// not grow with trace length
+class TraceReader {
+public:
+    struct Record {
+        TimeNs time;
+        // Point to mapped file; valid until reader is destroyed
+        std::string_view source;
+        std::string_view destination;
+        SizeByte size;
+    };
+
+    // Throws std::runtime_error if file can not be mapped
+    explicit TraceReader(const std::filesystem::path& path);
+    ~TraceReader();
+
+    TraceReader(const TraceReader&) = delete;
+    TraceReader& operator=(const TraceReader&) = delete;
+
+    // Returns std::nullopt at the end of trace; throws std::runtime_error on
+    // malformed line
+    std::optional<Record> next();
+
+private:
+    std::optional<Record> parse_line(std::string_view line) const;
+    // Releases whole pages before given position
+    void release_read_pages(std::size_t keep_from);
+
+    std::filesystem::path m_path;
+    char* m_data;
+    std::size_t m_size;
+    std::size_t m_position;
+    std::size_t m_released;
+    std::size_t m_line_number;
+};
+
+}  // namespace sim
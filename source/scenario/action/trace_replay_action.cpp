@@ -0,0 +1,83 @@
+#include "trace_replay_action.hpp"
+
+#include <spdlog/fmt/fmt.h>
+
+#include "event/action_step.hpp"
+#include "scheduler.hpp"
+#include "simulator.hpp"
+
+namespace sim {
+
+TraceReplayAction::TraceReplayAction(
+    std::filesystem::path a_trace_path, ConnectionFactory a_connection_factory,
+    std::optional<TimeNs> a_transient_time_wait)
+    : m_trace_path(std::move(a_trace_path)),
+      m_connection_factory(std::move(a_connection_factory)),
+      m_transient_time_wait(a_transient_time_wait),
+      m_simulator(nullptr) {}
+
+void TraceReplayAction::schedule(Simulator& simulator) {
+    m_simulator = &simulator;
+    m_reader = std::make_unique<TraceReader>(m_trace_path);
+    schedule_next();
+}
+
+void TraceReplayAction::step(std::size_t) {
+    const TraceReader::Record& record = m_next_record.value();
+    get_connection(record.source, record.destination)
+        ->add_data_to_send(record.size);
+    schedule_next();
+}
+
+void TraceReplayAction::schedule_next() {
+    std::optional<TraceReader::Record> record = m_reader->next();
+    if (!record.has_value()) {
+        // Trace is over; mapping is not needed anymore
+        m_reader.reset();
+        m_next_record.reset();
+        return;
+    }
+    if (m_next_record.has_value() && record->time < m_next_record->time) {
+        throw std::runtime_error(
+            fmt::format("Records of trace {} are not sorted by time",
+                        m_trace_path.string()));
+    }
+    m_next_record = record;
+    Scheduler::get_instance().add<ActionStep>(record->time, this, 0);
+}
+
+std::shared_ptr<IConnection> TraceReplayAction::get_connection(
+    std::string_view source, std::string_view destination) {
+    if (m_transient_time_wait.has_value()) {
+        std::shared_ptr<IConnection> connection =
+            m_connection_factory(Id(source), Id(destination));
+        if (auto result = m_simulator->add_transient_connection(
+                connection, m_transient_time_wait.value());
+            !result.has_value()) {
+            throw std::runtime_error(
+                fmt::format("Can not add connection {} from trace {}: {}",
+                            connection->get_id(), m_trace_path.string(),
+                            result.error()));
+        }
+        return connection;
+    }
+    std::pair<Id, Id> key(source, destination);
+    auto it = m_connections.find(key);
+    if (it != m_connections.end()) {
+        return it->second;
+    }
+    const auto& [source_id, destination_id] = key;
+    std::shared_ptr<IConnection> connection =
+        m_connection_factory(source_id, destination_id);
+    if (auto result = m_simulator->add_connection(connection);
+        !result.has_value()) {
+        throw std::runtime_error(
+            fmt::format("Can not add connection {} from trace {}: {}",
+                        connection->get_id(), m_trace_path.string(),
+                        result.error()));
+    }
+    m_connections.emplace(std::move(key), connection);
+    return connection;
+}
+
+}  // namespace sim
@@ -0,0 +1,51 @@
+#pragma once
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <optional>
+
+#include "connection/i_connection.hpp"
+#include "i_action.hpp"
+#include "trace_reader.hpp"
+#include "types.hpp"
+
+namespace sim {
+
+// Replays flow trace (see TraceReader for format): every record adds data to
+// connection between its hosts at record time. Records are read one by one
+// right before their time, connections are created by factory and added to
+// simulator when host pair appears first time, so memory depends on number of
+// host pairs, not on trace length.
+// If transient_time_wait is set, every record gets its own connection that is
+// added as transient one (see Simulator::add_transient_connection), so memory
+// depends only on number of records being transferred at the same time
+class TraceReplayAction : public ISteppedAction {
+public:
+    using ConnectionFactory = std::function<std::shared_ptr<IConnection>(
+        const Id& source, const Id& destination)>;
+
+    TraceReplayAction(
+        std::filesystem::path a_trace_path,
+        ConnectionFactory a_connection_factory,
+        std::optional<TimeNs> a_transient_time_wait = std::nullopt);
+
+    // Opens trace; throws std::runtime_error if it can not be read
+    void schedule(Simulator& simulator) final;
+    void step(std::size_t stream) final;
+
+private:
+    void schedule_next();
+    std::shared_ptr<IConnection> get_connection(std::string_view source,
+                                                std::string_view destination);
+
+    std::filesystem::path m_trace_path;
+    ConnectionFactory m_connection_factory;
+    std::optional<TimeNs> m_transient_time_wait;
+    Simulator* m_simulator;
+    std::unique_ptr<TraceReader> m_reader;
+    std::optional<TraceReader::Record> m_next_record;
+    // Key is (source, destination)
+    std::map<std::pair<Id, Id>, std::shared_ptr<IConnection>> m_connections;
+};
+
+}  // namespace sim
@@ -6,9 +6,17 @@ void Scenario::add_action(std::unique_ptr<IAction> action) {
     m_actions.emplace_back(std::move(action));
 }
 
-void Scenario::start() {
-    for (auto& action : m_actions) {
-        action->schedule();
+void Scenario::append(Scenario&& other) {
+    for (auto& action : other.m_actions) {
+        m_actions.emplace_back(std::move(action));
+    }
+    other.m_actions.clear();
+}
+
+void Scenario::start(Simulator& simulator) {
+    for (; m_started_actions_count < m_actions.size();
+         m_started_actions_count++) {
+        m_actions[m_started_actions_count]->schedule(simulator);
     }
 }
 
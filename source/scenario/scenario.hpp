@@ -21,11 +21,16 @@ public:
     // Add a new action to the scenario
     void add_action(std::unique_ptr<IAction> action);
 
-    // Run all actions (schedule them in the simulator)
-    void start();
+    // Moves actions of other scenario to the end of this one
+    void append(Scenario&& other);
+
+    // Run all actions (schedule them in the simulator); actions started by
+    // previous call are not scheduled again
+    void start(Simulator& simulator);
 
 private:
     std::vector<std::unique_ptr<IAction>> m_actions;
+    std::size_t m_started_actions_count = 0;
 };
 
 }  // namespace sim
@@ -20,16 +20,45 @@ bool Scheduler::tick() {
         std::move(const_cast<std::unique_ptr<Event>&>(m_events.top()));
     m_events.pop();
     m_current_event_local_time = event->get_time();
+    m_processed_events_count++;
+    if (m_fingerprint.has_value()) {
+        m_fingerprint->add_event(*event);
+    }
     event->operator()();
     return true;
 }
 
+bool Scheduler::tick_until(TimeNs end_time) {
+    if (m_events.empty() || m_events.top()->get_time() > end_time) {
+        return false;
+    }
+    return tick();
+}
+
 void Scheduler::clear() {
-    m_events = std::priority_queue<std::unique_ptr<Event>,
-                                   std::vector<std::unique_ptr<Event>>,
-                                   EventComparator>();
+    m_events = decltype(m_events)();
 }
 
 TimeNs Scheduler::get_current_time() { return m_current_event_local_time; };
 
+std::size_t Scheduler::get_events_count() const { return m_events.size(); }
+
+std::uint64_t Scheduler::get_processed_events_count() const {
+    return m_processed_events_count;
+}
+
+void Scheduler::enable_fingerprint() { m_fingerprint.emplace(); }
+
+void Scheduler::disable_fingerprint() { m_fingerprint.reset(); }
+
+const std::optional<Fingerprint>& Scheduler::get_fingerprint() const {
+    return m_fingerprint;
+}
+
+void Scheduler::add_summary_to_fingerprint(const Summary& summary) {
+    if (m_fingerprint.has_value()) {
+        m_fingerprint->add_summary(summary);
+    }
+}
+
 }  // namespace sim
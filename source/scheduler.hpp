@@ -1,10 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <queue>
 
 #include "event/event.hpp"
 #include "types.hpp"
+#include "utils/fingerprint.hpp"
+#include "utils/memory_accounting.hpp"
 
 namespace sim {
 
@@ -35,20 +38,43 @@ public:
 
     void clear();  // Clear all events
     bool tick();
+    // Same as tick, but does not process events later than end_time
+    bool tick_until(TimeNs end_time);
     TimeNs get_current_time();
+    // Number of pending events
+    std::size_t get_events_count() const;
+    // Number of events processed by tick since program start
+    std::uint64_t get_processed_events_count() const;
+
+    // Starts new fingerprint of executed events; it is kept until disabled,
+    // clear does not reset it
+    void enable_fingerprint();
+    void disable_fingerprint();
+    // Fingerprint of events executed since it was enabled
+    const std::optional<Fingerprint>& get_fingerprint() const;
+    // Adds summary of connections destroyed during run to fingerprint if it
+    // is enabled
+    void add_summary_to_fingerprint(const Summary& summary);
 
 private:
     // Private constructor to prevent instantiation
-    Scheduler() : m_current_event_local_time(TimeNs(0)) {}
+    Scheduler()
+        : m_current_event_local_time(TimeNs(0)), m_processed_events_count(0) {}
     // No copy constructor and assignment operators
     Scheduler(const Scheduler&) = delete;
     Scheduler& operator=(const Scheduler&) = delete;
 
-    std::priority_queue<std::unique_ptr<Event>,
-                        std::vector<std::unique_ptr<Event>>, EventComparator>
+    std::priority_queue<
+        std::unique_ptr<Event>,
+        std::vector<std::unique_ptr<Event>,
+                    TrackingAllocator<std::unique_ptr<Event>,
+                                      MemorySubsystem::Events>>,
+        EventComparator>
         m_events;
 
     TimeNs m_current_event_local_time;
+    std::uint64_t m_processed_events_count;
+    std::optional<Fingerprint> m_fingerprint;
 };
 
 }  // namespace sim
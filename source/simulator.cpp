@@ -1,8 +1,26 @@
 #include "simulator.hpp"
 
+#include <spdlog/fmt/ranges.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <iostream>
+
+#include "event/action_step.hpp"
+#include "event/event.hpp"
+#include "metrics/metrics_collector.hpp"
+#include "utils/hash.hpp"
+#include "utils/routing_cache.hpp"
+
 namespace sim {
 
-Simulator::Simulator() : m_state(State::BEFORE_SIMULATION_START) {}
+Simulator::Simulator()
+    : m_state(State::BEFORE_SIMULATION_START),
+      m_next_memory_report_time(0),
+      m_stop_on_completion(false),
+      m_next_batch_time(0),
+      m_destroyed_connections_delivered_data(0) {}
 
 Simulator::AddResult Simulator::add_host(std::shared_ptr<IHost> host) {
     return default_add_object(host, m_hosts);
@@ -24,7 +42,7 @@ Simulator::DeleteResult Simulator::delete_switch(
 
 Simulator::AddResult Simulator::add_connection(
     std::shared_ptr<IConnection> connection) {
-    return default_add_object(connection, m_connections);
+    return default_add_object(connection, m_connections, true);
 }
 
 Simulator::DeleteResult Simulator::delete_connection(
@@ -32,6 +50,116 @@ Simulator::DeleteResult Simulator::delete_connection(
     return default_delete_object(connection, m_connections);
 }
 
+Simulator::AddResult Simulator::add_transient_connection(
+    std::shared_ptr<IConnection> connection, TimeNs time_wait) {
+    if (AddResult result = add_connection(connection); !result.has_value()) {
+        return result;
+    }
+    connection->set_completion_callback(
+        [this, weak_connection = std::weak_ptr<IConnection>(connection),
+         time_wait]() {
+            on_connection_completed(weak_connection, time_wait);
+        });
+    return {};
+}
+
+class Simulator::ConnectionTeardown : public Event {
+public:
+    ConnectionTeardown(TimeNs a_time, Simulator* a_simulator,
+                       std::weak_ptr<IConnection> a_connection,
+                       TimeNs a_time_wait)
+        : Event(a_time),
+          m_simulator(a_simulator),
+          m_connection(std::move(a_connection)),
+          m_time_wait(a_time_wait) {}
+
+    void operator()() final {
+        m_simulator->teardown_connection(std::move(m_connection), m_time_wait);
+    }
+
+    std::uint64_t get_fingerprint() const final {
+        constexpr std::uint64_t kind =
+            utils::hash_string("Simulator::ConnectionTeardown");
+        std::shared_ptr<IConnection> connection = m_connection.lock();
+        return utils::hash_combine(
+            kind, (connection == nullptr
+                       ? 0
+                       : utils::hash_string(connection->get_id())));
+    }
+
+private:
+    Simulator* m_simulator;
+    std::weak_ptr<IConnection> m_connection;
+    TimeNs m_time_wait;
+};
+
+void Simulator::on_connection_completed(std::weak_ptr<IConnection> connection,
+                                        TimeNs time_wait) {
+    // Connection is not destroyed right away: flow that called completion
+    // callback is still in use
+    Scheduler::get_instance().add<ConnectionTeardown>(
+        Scheduler::get_instance().get_current_time() + time_wait, this,
+        std::move(connection), time_wait);
+}
+
+void Simulator::teardown_connection(std::weak_ptr<IConnection> connection,
+                                    TimeNs time_wait) {
+    std::shared_ptr<IConnection> shared_connection = connection.lock();
+    // Connection may be already destroyed by teardown scheduled by earlier
+    // completion or get more data during time wait
+    if (shared_connection == nullptr ||
+        !m_connections.contains(shared_connection) ||
+        !shared_connection->is_completed()) {
+        return;
+    }
+    FlowsSet flows = shared_connection->get_flows();
+    if (std::any_of(flows.begin(), flows.end(), [](const auto& flow) {
+            return flow->has_pending_references();
+        })) {
+        Scheduler::get_instance().add<ConnectionTeardown>(
+            Scheduler::get_instance().get_current_time() + time_wait, this,
+            std::move(connection), time_wait);
+        return;
+    }
+
+    Summary connection_summary;
+    connection_summary.add_connection(shared_connection, &m_ideal_fct_model);
+    if (m_fct_report.has_value()) {
+        m_fct_report->add_summary(connection_summary);
+    }
+    if (m_summary_writer != nullptr) {
+        // Summary is dropped right away, so it is checked here
+        connection_summary.check();
+        m_summary_writer->write(connection_summary);
+        Scheduler::get_instance().add_summary_to_fingerprint(
+            connection_summary);
+    } else {
+        m_destroyed_connections_summary.add_connection(shared_connection,
+                                                       &m_ideal_fct_model);
+    }
+    for (const auto& flow : flows) {
+        m_destroyed_connections_delivered_data +=
+            flow->get_delivered_data_size();
+        MetricsCollector::get_instance().remove_flow_metrics(flow->get_id());
+    }
+    // Flows refer to connection, so they are deleted from it to break
+    // ownership cycle
+    for (const auto& flow : flows) {
+        if (!shared_connection->delete_flow(flow)) {
+            LOG_ERROR(fmt::format("Can not delete flow {} of connection {}",
+                                  flow->get_id(),
+                                  shared_connection->get_id()));
+        }
+    }
+    shared_connection->set_completion_callback({});
+    if (DeleteResult result =
+            default_delete_object(shared_connection, m_connections, true);
+        !result.has_value()) {
+        LOG_ERROR(fmt::format("Can not delete completed connection {}: {}",
+                              shared_connection->get_id(), result.error()));
+    }
+}
+
 Simulator::AddResult Simulator::add_link(std::shared_ptr<ILink> link) {
     if (!is_valid_link(link)) {
         return std::unexpected("Link is incorrect");
@@ -66,15 +194,22 @@ void Simulator::set_scenario(Scenario&& scenario) {
     m_scenario = std::move(scenario);
 }
 
+void Simulator::add_scenario(Scenario&& scenario) {
+    m_scenario.append(std::move(scenario));
+    if (m_state == State::SIMULATION_IN_PROGRESS) {
+        m_scenario.start(*this);
+    }
+}
+
 std::vector<std::shared_ptr<IDevice>> Simulator::get_devices() const {
     std::vector<std::shared_ptr<IDevice>> devices;
 
     for (auto host : m_hosts) {
-        devices.push_back(dynamic_pointer_cast<IDevice>(host));
+        devices.push_back(host);
     }
 
     for (auto swtch : m_switches) {
-        devices.push_back(dynamic_pointer_cast<IDevice>(swtch));
+        devices.push_back(swtch);
     }
 
     return devices;
@@ -82,33 +217,323 @@ std::vector<std::shared_ptr<IDevice>> Simulator::get_devices() const {
 
 // Calls BFS for each device to build the routing table
 void Simulator::recalculate_paths() {
+    std::optional<RoutingCache> cache;
+    if (m_routing_cache_dir.has_value()) {
+        cache.emplace(m_routing_cache_dir.value(), get_devices(),
+                      std::vector<std::shared_ptr<ILink>>(m_links.begin(),
+                                                          m_links.end()));
+        if (cache->load()) {
+            LOG_INFO(fmt::format("Routing tables loaded from {}",
+                                 cache->get_file_path().string()));
+            return;
+        }
+    }
     for (auto src_device : get_devices()) {
-        RoutingTable routing_table =
-            bfs(dynamic_pointer_cast<IRoutingDevice>(src_device));
+        RoutingTable routing_table = bfs(src_device);
         for (auto [dest_device_id, links] : routing_table) {
             for (auto [link, paths_count] : links) {
                 src_device->update_routing_table(dest_device_id, link.lock(),
                                                  paths_count);
             }
         }
+        if (cache.has_value()) {
+            cache->add_routing_table(src_device, routing_table);
+        }
+    }
+    if (cache.has_value() && cache->store()) {
+        LOG_INFO(fmt::format("Routing tables stored to {}",
+                             cache->get_file_path().string()));
     }
 }
 
-void Simulator::set_stop_time(TimeNs stop_time) { m_stop_time = stop_time; }
+void Simulator::set_routing_cache_dir(
+    std::filesystem::path routing_cache_dir) {
+    m_routing_cache_dir = std::move(routing_cache_dir);
+}
 
-void Simulator::start() {
+void Simulator::freeze_topology() {
+    for (auto device : get_devices()) {
+        device->freeze();
+    }
+    for (auto link : m_links) {
+        if (auto builtin_link = std::dynamic_pointer_cast<Link>(link)) {
+            builtin_link->freeze();
+        }
+    }
+}
+
+void Simulator::set_stop_time(TimeNs stop_time) {
+    m_stop_time = stop_time;
+    if (m_state == State::SIMULATION_IN_PROGRESS) {
+        Scheduler::get_instance().add<Stop>(stop_time);
+    }
+}
+
+void Simulator::prepare_start() {
     recalculate_paths();
+    freeze_topology();
 
     if (m_stop_time.has_value()) {
         Scheduler::get_instance().add<Stop>(m_stop_time.value());
     }
 
-    m_scenario.start();
+    m_scenario.start(*this);
 
     m_state = State::SIMULATION_IN_PROGRESS;
+    if (m_wall_time_limit.has_value()) {
+        set_wall_time_limit(m_wall_time_limit.value());
+    }
+}
+
+void Simulator::set_memory_report_interval(TimeNs interval) {
+    m_memory_report_interval = interval;
+    m_next_memory_report_time = Scheduler::get_instance().get_current_time();
+}
+
+void Simulator::set_stop_on_completion(bool stop_on_completion) {
+    m_stop_on_completion = stop_on_completion;
+}
+
+void Simulator::set_wall_time_limit(std::chrono::duration<double> limit) {
+    m_wall_time_limit = limit;
+    if (m_state == State::SIMULATION_IN_PROGRESS) {
+        m_wall_time_deadline = std::chrono::steady_clock::now() +
+                               std::chrono::duration_cast<
+                                   std::chrono::steady_clock::duration>(limit);
+    }
+}
+
+bool Simulator::is_workload_completed() {
+    if (ActionStep::get_pending_count() != 0) {
+        m_incomplete_connections.reset();
+        return false;
+    }
+    auto is_completed = [](const std::shared_ptr<IConnection>& connection) {
+        return connection->get_total_data_added() == SizeByte(0) ||
+               connection->is_completed();
+    };
+    if (!m_incomplete_connections.has_value()) {
+        m_incomplete_connections.emplace();
+        for (const auto& connection : m_connections) {
+            if (!is_completed(connection)) {
+                m_incomplete_connections->push_back(connection);
+            }
+        }
+    }
+    // Destroyed transient connections were completed
+    while (!m_incomplete_connections->empty()) {
+        std::shared_ptr<IConnection> connection =
+            m_incomplete_connections->back().lock();
+        if (connection != nullptr && !is_completed(connection)) {
+            return false;
+        }
+        m_incomplete_connections->pop_back();
+    }
+    return true;
+}
+
+void Simulator::set_steady_state_detector(SteadyStateDetector detector,
+                                          TimeNs start_time) {
+    m_steady_state_detector.emplace(std::move(detector));
+    m_next_batch_time = start_time;
+    m_batch_start.reset();
+}
+
+const std::optional<SteadyStateDetector>&
+Simulator::get_steady_state_detector() const {
+    return m_steady_state_detector;
+}
+
+SizeByte Simulator::get_delivered_data_size() const {
+    SizeByte delivered = m_destroyed_connections_delivered_data;
+    for (const auto& connection : m_connections) {
+        for (const auto& flow : connection->get_flows()) {
+            delivered += flow->get_delivered_data_size();
+        }
+    }
+    return delivered;
+}
+
+void Simulator::on_batch_end(TimeNs time) {
+    SteadyStateDetector& detector = m_steady_state_detector.value();
+    bool is_throughput =
+        detector.get_metric() == SteadyStateMetric::Throughput;
+    SizeByte delivered =
+        (is_throughput ? get_delivered_data_size() : SizeByte(0));
+    if (m_batch_start.has_value()) {
+        auto [start_time, start_delivered] = m_batch_start.value();
+        double value = 0;
+        if (is_throughput) {
+            // Bits per nanosecond are Gbps
+            value = (delivered - start_delivered).value() * 8 /
+                    (time - start_time).value();
+        } else {
+            for (const auto& link : m_links) {
+                value += (link->get_from_egress_queue_size() +
+                          link->get_to_ingress_queue_size())
+                             .value();
+            }
+        }
+        detector.add_batch(value);
+        if (detector.is_converged()) {
+            LOG_INFO(fmt::format(
+                "Steady state is reached: {} is {} +- {} after {} batches; "
+                "simulation stopped at {} ns",
+                to_string(detector.get_metric()), detector.get_mean(),
+                detector.get_half_width(), detector.get_batches_count(),
+                time.value()));
+            Scheduler::get_instance().clear();
+        }
+    }
+    // Batch lasts until the first event after its nominal end
+    m_batch_start = {time, delivered};
+    while (!(m_next_batch_time > time)) {
+        m_next_batch_time += detector.get_batch_duration();
+    }
+}
+
+void Simulator::set_progress_reporter(ProgressReporter reporter) {
+    m_progress_reporter.emplace(std::move(reporter));
+}
+
+void Simulator::on_event_processed() {
+    Scheduler& scheduler = Scheduler::get_instance();
+    if (m_progress_reporter.has_value() &&
+        m_progress_reporter->is_report_due(
+            scheduler.get_processed_events_count())) {
+        report_progress();
+    }
+    if (m_steady_state_detector.has_value() &&
+        !(m_next_batch_time > scheduler.get_current_time())) {
+        on_batch_end(scheduler.get_current_time());
+    }
+    if (m_stop_on_completion && is_workload_completed()) {
+        LOG_INFO(fmt::format(
+            "All data is delivered; simulation stopped at {} ns with {} "
+            "pending events",
+            scheduler.get_current_time().value(),
+            scheduler.get_events_count()));
+        scheduler.clear();
+    }
+    if (m_wall_time_deadline.has_value() &&
+        is_wall_clock_check_due(scheduler.get_processed_events_count()) &&
+        std::chrono::steady_clock::now() > m_wall_time_deadline.value()) {
+        LOG_WARN(fmt::format(
+            "Wall-clock time limit exceeded; simulation stopped at {} ns",
+            scheduler.get_current_time().value()));
+        scheduler.clear();
+    }
+    if (m_memory_report_interval.has_value()) {
+        TimeNs time = Scheduler::get_instance().get_current_time();
+        if (!(m_next_memory_report_time > time)) {
+            report_memory_usage(time);
+            while (!(m_next_memory_report_time > time)) {
+                m_next_memory_report_time += m_memory_report_interval.value();
+            }
+        }
+    }
+}
+
+void Simulator::report_memory_usage(TimeNs time) {
+    for (std::size_t i = 0;
+         i < static_cast<std::size_t>(MemorySubsystem::ENUM_SIZE); i++) {
+        MemorySubsystem subsystem = static_cast<MemorySubsystem>(i);
+        SizeByte usage(MemoryAccounting::get_current(subsystem));
+        MetricsCollector::get_instance().add_memory_usage(subsystem, time,
+                                                          usage);
+    }
+    LOG_INFO(fmt::format("Memory usage at {} ns: {}", time.value(),
+                         MemoryAccounting::to_string()));
+}
+
+void Simulator::report_progress() {
+    std::size_t active_flows = 0;
+    for (const auto& connection : m_connections) {
+        for (const auto& flow : connection->get_flows()) {
+            active_flows += flow->get_delivered_data_size() <
+                            flow->get_total_data_size_added_from_conn();
+        }
+    }
+    const Scheduler& scheduler = Scheduler::get_instance();
+    m_progress_reporter->report(
+        Progress{Scheduler::get_instance().get_current_time(), m_stop_time,
+                 scheduler.get_processed_events_count(),
+                 scheduler.get_events_count(), active_flows});
+}
+
+void Simulator::start() {
+    if (m_state == State::BEFORE_SIMULATION_START) {
+        prepare_start();
+    }
     while (Scheduler::get_instance().tick()) {
+        on_event_processed();
     }
     m_state = State::SIMULATION_ENDED;
+    if (m_progress_reporter.has_value()) {
+        report_progress();
+    }
+    LOG_INFO(fmt::format("Memory usage at the end of simulation: {}",
+                         MemoryAccounting::to_string()));
+}
+
+void Simulator::run_until(TimeNs time) {
+    if (m_state == State::BEFORE_SIMULATION_START) {
+        prepare_start();
+    }
+    while (Scheduler::get_instance().tick_until(time)) {
+        on_event_processed();
+    }
+}
+
+std::optional<std::size_t> Simulator::fork_at(TimeNs fork_time,
+                                              std::size_t branches_count) {
+    // Otherwise run would end right after warm-up without any results
+    if (branches_count == 0) {
+        throw std::invalid_argument("At least one branch should be forked");
+    }
+    run_until(fork_time);
+
+    // Otherwise buffered output is written by every branch
+    Logger::get_instance().flush();
+    std::cout.flush();
+
+    std::vector<pid_t> branches;
+    std::string error;
+    for (std::size_t i = 0; i < branches_count; i++) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            return i;
+        }
+        if (pid == -1) {
+            error = fmt::format("Can not fork branch {}: {}", i,
+                                std::strerror(errno));
+            break;
+        }
+        branches.push_back(pid);
+    }
+
+    std::vector<std::size_t> failed_branches;
+    for (std::size_t i = 0; i < branches.size(); i++) {
+        int status = 0;
+        if (waitpid(branches[i], &status, 0) == -1 || !WIFEXITED(status) ||
+            WEXITSTATUS(status) != 0) {
+            failed_branches.push_back(i);
+        }
+    }
+    if (!failed_branches.empty()) {
+        error += fmt::format("{}Branches {} exited with error",
+                             (error.empty() ? "" : "; "),
+                             fmt::join(failed_branches, ", "));
+    }
+    if (!error.empty()) {
+        throw std::runtime_error(error);
+    }
+    m_state = State::SIMULATION_ENDED;
+    return std::nullopt;
+}
+
+std::unordered_set<std::shared_ptr<ILink>> Simulator::get_links() const {
+    return m_links;
 }
 
 std::unordered_set<std::shared_ptr<IConnection>> Simulator::get_connections()
@@ -116,4 +541,38 @@ std::unordered_set<std::shared_ptr<IConnection>> Simulator::get_connections()
     return m_connections;
 }
 
+Summary Simulator::get_summary() const {
+    Summary summary = m_destroyed_connections_summary;
+    for (const auto& connection : m_connections) {
+        summary.add_connection(connection, &m_ideal_fct_model);
+    }
+    return summary;
+}
+
+void Simulator::set_summary_writer(std::shared_ptr<SummaryCsvWriter> writer) {
+    m_summary_writer = std::move(writer);
+    m_destroyed_connections_summary.check();
+    m_summary_writer->write(m_destroyed_connections_summary);
+    Scheduler::get_instance().add_summary_to_fingerprint(
+        m_destroyed_connections_summary);
+    m_destroyed_connections_summary = Summary();
+}
+
+void Simulator::set_fct_report(FctReport report) {
+    m_fct_report = std::move(report);
+}
+
+std::optional<FctReport> Simulator::get_fct_report() const {
+    if (!m_fct_report.has_value()) {
+        return std::nullopt;
+    }
+    FctReport report = m_fct_report.value();
+    for (const auto& connection : m_connections) {
+        Summary connection_summary;
+        connection_summary.add_connection(connection, &m_ideal_fct_model);
+        report.add_summary(connection_summary);
+    }
+    return report;
+}
+
 }  // namespace sim
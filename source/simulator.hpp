@@ -2,7 +2,9 @@
 
 #include <spdlog/fmt/fmt.h>
 
+#include <chrono>
 #include <expected>
+#include <filesystem>
 #include <map>
 #include <unordered_set>
 #include <variant>
@@ -13,8 +15,12 @@
 #include "device/switch.hpp"
 #include "event/stop.hpp"
 #include "link/link.hpp"
+#include "metrics/fct_report.hpp"
+#include "metrics/steady_state_detector.hpp"
 #include "scenario/scenario.hpp"
 #include "utils/algorithms.hpp"
+#include "utils/progress_reporter.hpp"
+#include "utils/summary.hpp"
 #include "utils/validation.hpp"
 
 namespace sim {
@@ -41,28 +47,109 @@ public:
     [[nodiscard]] DeleteResult delete_switch(
         std::shared_ptr<ISwitch> switch_device);
 
+    // Unlike other objects, connections may be added during simulation
     [[nodiscard]] AddResult add_connection(
         std::shared_ptr<IConnection> connection);
     [[nodiscard]] DeleteResult delete_connection(
         std::shared_ptr<IConnection> connection);
+    // Transient connection is destroyed once all data added to it is
+    // delivered, so workloads with many short connections hold state only for
+    // active ones; its summary is captured right before that (see
+    // get_summary, set_fct_report and set_summary_writer). Like TCP
+    // TIME_WAIT, destruction is delayed by time_wait after completion; while
+    // events or packets (e.g. spurious retransmissions) still refer to its
+    // flows, it is delayed by time_wait again
+    [[nodiscard]] AddResult add_transient_connection(
+        std::shared_ptr<IConnection> connection, TimeNs time_wait);
 
     [[nodiscard]] AddResult add_link(std::shared_ptr<ILink> link);
     [[nodiscard]] DeleteResult delete_link(std::shared_ptr<ILink> link);
 
     void set_scenario(Scenario&& scenario);
+    // Unlike set_scenario, keeps actions of current scenario; if simulation
+    // is in progress, new actions are scheduled right away
+    void add_scenario(Scenario&& scenario);
 
     std::vector<std::shared_ptr<IDevice>> get_devices() const;
 
-    // Calls BFS for each device to build the routing table
+    // Calls BFS for each device to build the routing table; if routing cache
+    // directory is set, tables are loaded from there when topology was
+    // already seen and stored there otherwise
     void recalculate_paths();
 
+    void set_routing_cache_dir(std::filesystem::path routing_cache_dir);
+
+    // Lets devices cache plain pointers to links; topology can not be changed
+    // after simulation start, so it is called right before it
+    void freeze_topology();
+
+    // If simulation is in progress, stop is scheduled right away; it does not
+    // cancel stop scheduled earlier
     void set_stop_time(TimeNs stop_time);
 
-    // Start simulation
+    // Memory usage of subsystems (see MemoryAccounting) is recorded to
+    // `memory` metrics and logged every interval of simulation time
+    void set_memory_report_interval(TimeNs interval);
+
+    // If set, simulation stops as soon as all data added to connections is
+    // delivered and scenario has no pending actions (e.g. without waiting
+    // for stale retransmission timeouts)
+    void set_stop_on_completion(bool stop_on_completion);
+
+    // Simulation stops (with warning) when it runs longer than given
+    // wall-clock time since its start
+    void set_wall_time_limit(std::chrono::duration<double> limit);
+
+    // Batches of detector start at start_time (i.e. after warm-up); once it
+    // converges, simulation is stopped
+    void set_steady_state_detector(SteadyStateDetector detector,
+                                   TimeNs start_time);
+    const std::optional<SteadyStateDetector>& get_steady_state_detector()
+        const;
+
+    // Progress of simulation is reported by reporter while it runs
+    void set_progress_reporter(ProgressReporter reporter);
+
+    // Start simulation (or continue it after run_until)
     void start();
 
+    // Starts simulation if it is not started yet and processes events up to
+    // given time inclusive
+    void run_until(TimeNs time);
+
+    // Runs simulation until fork_time and then forks branches_count child
+    // processes; each of them gets copy-on-write copy of whole warmed-up state
+    // and may change it (e.g. add scenario) before continuing by start().
+    // Returns index of the branch in child process; parent waits for all
+    // branches and returns std::nullopt. Throws if branches_count is zero or
+    // some branch can not be started or exits with error. Warmed-up state
+    // exists only in branch processes: it is not saved anywhere
+    std::optional<std::size_t> fork_at(TimeNs fork_time,
+                                       std::size_t branches_count);
+
+    std::unordered_set<std::shared_ptr<ILink>> get_links() const;
+
+    // Returns connections that are not destroyed yet
     std::unordered_set<std::shared_ptr<IConnection>> get_connections() const;
 
+    // Summary of current connections and destroyed transient ones; the
+    // latter are not kept if summary writer is set
+    Summary get_summary() const;
+
+    // Summaries of destroyed transient connections are written right at their
+    // teardown (and added to scheduler fingerprint) instead of being kept, so
+    // memory of workloads with many short connections does not grow with
+    // number of finished flows; already kept ones are written at once. Should
+    // be set after fork_at: branches would share buffered output otherwise
+    void set_summary_writer(std::shared_ptr<SummaryCsvWriter> writer);
+
+    // Flows of destroyed transient connections are added to report right at
+    // their teardown
+    void set_fct_report(FctReport report);
+    // Report of destroyed connections and current ones; std::nullopt if it
+    // is not set
+    std::optional<FctReport> get_fct_report() const;
+
 private:
     enum class State {
         BEFORE_SIMULATION_START,
@@ -70,13 +157,41 @@ private:
         SIMULATION_ENDED
     };
 
+    class ConnectionTeardown;
+
+    // Builds routing tables, schedules stop and scenario
+    void prepare_start();
+
+    // Called after every processed event
+    void on_event_processed();
+    void report_memory_usage(TimeNs time);
+    void report_progress();
+    // True if all connections delivered their data and scenario has no
+    // pending actions
+    bool is_workload_completed();
+    void on_batch_end(TimeNs time);
+    // Data delivered by all flows, including ones of destroyed connections
+    SizeByte get_delivered_data_size() const;
+
+    void on_connection_completed(std::weak_ptr<IConnection> connection,
+                                 TimeNs time_wait);
+    void teardown_connection(std::weak_ptr<IConnection> connection,
+                             TimeNs time_wait);
+
+    // Objects that do not change topology (connections) may be added during
+    // simulation
     template <typename T>
     [[nodiscard]] AddResult default_add_object(
         std::shared_ptr<T> object,
-        std::unordered_set<std::shared_ptr<T>>& objects_stotage) {
+        std::unordered_set<std::shared_ptr<T>>& objects_stotage,
+        bool allowed_during_simulation = false) {
         static_assert(std::is_base_of_v<Identifiable, T>,
                       "T must be implement Identifiable interface");
-        if (m_state != State::BEFORE_SIMULATION_START) {
+        bool allowed_state =
+            m_state == State::BEFORE_SIMULATION_START ||
+            (allowed_during_simulation &&
+             m_state == State::SIMULATION_IN_PROGRESS);
+        if (!allowed_state) {
             return std::unexpected(
                 "Addig objects at state different from BEFORE_SIMULATION is "
                 "not "
@@ -111,10 +226,15 @@ private:
     template <typename T>
     [[nodiscard]] DeleteResult default_delete_object(
         std::shared_ptr<T> object,
-        std::unordered_set<std::shared_ptr<T>>& objects_stotage) {
+        std::unordered_set<std::shared_ptr<T>>& objects_stotage,
+        bool allowed_during_simulation = false) {
         static_assert(std::is_base_of_v<Identifiable, T>,
                       "T must be implement Identifiable interface");
-        if (m_state != State::BEFORE_SIMULATION_START) {
+        bool allowed_state =
+            m_state == State::BEFORE_SIMULATION_START ||
+            (allowed_during_simulation &&
+             m_state == State::SIMULATION_IN_PROGRESS);
+        if (!allowed_state) {
             return std::unexpected(
                 "Deleting objects at state different from BEFORE_SIMULATION is "
                 "not "
@@ -149,11 +269,33 @@ private:
 private:
     State m_state;
     std::optional<TimeNs> m_stop_time;
+    std::optional<TimeNs> m_memory_report_interval;
+    TimeNs m_next_memory_report_time;
+    std::optional<ProgressReporter> m_progress_reporter;
+    bool m_stop_on_completion;
+    // Connections that were not completed at previous check; collected once
+    // scenario has no pending actions, as after that connections can only
+    // become completed
+    std::optional<std::vector<std::weak_ptr<IConnection>>>
+        m_incomplete_connections;
+    std::optional<std::chrono::duration<double>> m_wall_time_limit;
+    std::optional<std::chrono::steady_clock::time_point> m_wall_time_deadline;
+    std::optional<SteadyStateDetector> m_steady_state_detector;
+    TimeNs m_next_batch_time;
+    // Time and delivered data at start of current batch
+    std::optional<std::pair<TimeNs, SizeByte>> m_batch_start;
+    SizeByte m_destroyed_connections_delivered_data;
+    std::optional<std::filesystem::path> m_routing_cache_dir;
     std::unordered_set<std::shared_ptr<IHost>> m_hosts;
     std::unordered_set<std::shared_ptr<ISwitch>> m_switches;
     std::unordered_set<std::shared_ptr<IConnection>> m_connections;
     std::unordered_set<std::shared_ptr<ILink>> m_links;
     Scenario m_scenario;
+    Summary m_destroyed_connections_summary;
+    std::optional<FctReport> m_fct_report;
+    std::shared_ptr<SummaryCsvWriter> m_summary_writer;
+    // Caches paths between hosts, so it is filled by const get_summary too
+    mutable IdealFctModel m_ideal_fct_model;
 };
 
 }  // namespace sim
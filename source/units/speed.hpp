@@ -1,4 +1,5 @@
 #pragma once
+#include "ld_comparation.hpp"
 #include "size.hpp"
 #include "speed.hpp"
 
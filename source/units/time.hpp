@@ -5,7 +5,6 @@
 #include <iostream>
 #include <type_traits>
 
-#include "ld_comparation.hpp"
 
 struct Nanosecond {
     static constexpr uint64_t to_nanoseconds_multiplier = 1;
@@ -29,77 +28,99 @@ concept IsTimeBase = requires {
     { T::to_nanoseconds_multiplier } -> std::convertible_to<uint64_t>;
 };
 
+// Number of picoseconds in one nanosecond; time is stored in picoseconds
+inline constexpr std::int64_t PICOSECONDS_IN_NANOSECOND = 1'000;
+
 template <IsTimeBase TTimeBase>
 class Time {
 public:
     using ThisTime = Time<TTimeBase>;
 
-    constexpr Time() : m_value_ns(0.0) {}
+    constexpr Time() : m_value_ps(0) {}
     template <IsTimeBase USizeBase>
     constexpr Time(Time<USizeBase> a_size)
-        : m_value_ns(a_size.value_nanoseconds()) {}
+        : m_value_ps(a_size.value_picoseconds()) {}
 
     // Attention: a_value given in TTimeBase units!
+    // Value is rounded to the nearest picosecond
     explicit constexpr Time(double a_value)
-        : m_value_ns(a_value * TTimeBase::to_nanoseconds_multiplier) {}
+        : m_value_ps(
+              round_to_picoseconds(a_value * M_PICOSECONDS_MULTIPLIER)) {}
+
+    static constexpr ThisTime from_picoseconds(std::int64_t a_value_ps) {
+        ThisTime time;
+        time.m_value_ps = a_value_ps;
+        return time;
+    }
 
     constexpr double value() const {
-        // Round up here to get maximal time
-        return m_value_ns / TTimeBase::to_nanoseconds_multiplier;
+        return static_cast<double>(m_value_ps) / M_PICOSECONDS_MULTIPLIER;
     }
 
     explicit constexpr operator double() const { return value(); }
 
-    constexpr double value_nanoseconds() const { return m_value_ns; }
+    constexpr double value_nanoseconds() const {
+        return static_cast<double>(m_value_ps) / PICOSECONDS_IN_NANOSECOND;
+    }
+
+    constexpr std::int64_t value_picoseconds() const { return m_value_ps; }
 
     constexpr ThisTime operator+(ThisTime time) const {
-        return Time<Nanosecond>(m_value_ns + time.m_value_ns);
+        return from_picoseconds(m_value_ps + time.m_value_ps);
     }
 
     constexpr ThisTime operator-(ThisTime time) const {
-        return Time<Nanosecond>(m_value_ns - time.m_value_ns);
+        return from_picoseconds(m_value_ps - time.m_value_ps);
     }
 
     constexpr ThisTime operator*(double mult) const {
-        return Time<Nanosecond>(m_value_ns * mult);
+        return from_picoseconds(round_to_picoseconds(m_value_ps * mult));
     }
 
     constexpr ThisTime& operator++() {
-        m_value_ns += TTimeBase::to_nanoseconds_multiplier;
+        m_value_ps += M_PICOSECONDS_MULTIPLIER;
         return *this;
     }
 
     constexpr double operator/(ThisTime time) const {
-        return m_value_ns / time.value_nanoseconds();
+        return static_cast<double>(m_value_ps) / time.m_value_ps;
     }
 
     constexpr ThisTime operator/(double value) const {
-        return Time<Nanosecond>(m_value_ns / value);
+        return from_picoseconds(round_to_picoseconds(m_value_ps / value));
     }
 
-    constexpr void operator+=(ThisTime time) { m_value_ns += time.m_value_ns; }
-    constexpr void operator-=(ThisTime time) { m_value_ns -= time.m_value_ns; }
+    constexpr void operator+=(ThisTime time) { m_value_ps += time.m_value_ps; }
+    constexpr void operator-=(ThisTime time) { m_value_ps -= time.m_value_ps; }
 
-    constexpr void operator*=(double mult) { m_value_ns *= mult; }
+    constexpr void operator*=(double mult) { *this = *this * mult; }
 
-    constexpr void operator/=(double mult) { m_value_ns /= mult; }
+    constexpr void operator/=(double mult) { *this = *this / mult; }
 
     bool constexpr operator<(ThisTime time) const {
-        return m_value_ns < time.m_value_ns;
+        return m_value_ps < time.m_value_ps;
     }
 
     bool constexpr operator>(ThisTime time) const {
-        return m_value_ns > time.m_value_ns;
+        return m_value_ps > time.m_value_ps;
     }
 
     bool constexpr operator==(ThisTime time) const {
-        return equal(m_value_ns, time.value_nanoseconds());
+        return m_value_ps == time.m_value_ps;
     }
 
     bool constexpr operator!=(ThisTime time) const { return !operator==(time); }
 
 private:
-    double m_value_ns;  // Time in nanoseconds
+    static constexpr std::int64_t M_PICOSECONDS_MULTIPLIER =
+        TTimeBase::to_nanoseconds_multiplier * PICOSECONDS_IN_NANOSECOND;
+
+    static constexpr std::int64_t round_to_picoseconds(double value_ps) {
+        return static_cast<std::int64_t>(value_ps < 0 ? value_ps - 0.5
+                                                      : value_ps + 0.5);
+    }
+
+    std::int64_t m_value_ps;  // Time in picoseconds
 };
 
 template <IsTimeBase TTimeBase>
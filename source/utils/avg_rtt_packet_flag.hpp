@@ -1,37 +1,37 @@
 #pragma once
-#include <string>
+#include <bit>
 
-#include "flag_manager.hpp"
+#include "flag_field.hpp"
 
 namespace sim {
 
-static std::string packet_avg_rtt_label = "avg_rtt";
 // to this type real rtt value will be casted
 using AvgRttCastType = float;
-// to this type casted value will be transormed using reinterpred_cast
+// to this type casted value will be transormed using bit_cast
 using AvgRttFlagType = uint32_t;
 
 static_assert(sizeof(AvgRttCastType) == sizeof(AvgRttFlagType),
               "Rtt cast type and flag type should have same size");
 
-inline bool register_packet_avg_rtt_flag(BaseFlagManager& flag_manager) {
-    return flag_manager.register_flag_by_length(packet_avg_rtt_label,
-                                                sizeof_bits(AvgRttCastType));
-}
+// Average RTT is read by switches (see AdaptiveFlowletHasher), so it is
+// placed at the beginning of packet flags; flow-specific fields go after it
+using AvgRttFlag =
+    FlagField<PacketFlagsBase, 0, sizeof_bits(AvgRttFlagType)>;
 
-inline void set_avg_rtt_flag(BaseFlagManager& flag_manager, BaseBitset& bitset,
-                             TimeNs rtt) {
+inline void set_avg_rtt_flag(BaseBitset& bitset, TimeNs rtt) {
     AvgRttCastType value = rtt.value_nanoseconds();
     AvgRttFlagType casted_value = std::bit_cast<AvgRttFlagType>(value);
-    flag_manager.set_flag(bitset, packet_avg_rtt_label, casted_value);
+    AvgRttFlag::set(bitset, casted_value);
 }
 
-inline TimeNs get_avg_rtt_label(const BaseFlagManager& flag_manager,
-                                const BaseBitset& bitset) {
-    AvgRttFlagType casted_value =
-        flag_manager.get_flag(bitset, packet_avg_rtt_label);
-    AvgRttCastType value = std::bit_cast<AvgRttCastType>(casted_value);
+inline std::optional<TimeNs> get_avg_rtt_flag(const BaseBitset& bitset) {
+    std::optional<PacketFlagsBase> casted_value = AvgRttFlag::get(bitset);
+    if (!casted_value.has_value()) {
+        return std::nullopt;
+    }
+    AvgRttCastType value = std::bit_cast<AvgRttCastType>(
+        static_cast<AvgRttFlagType>(casted_value.value()));
     return TimeNs(value);
 }
 
-}  // namespace sim
\ No newline at end of file
+}  // namespace sim
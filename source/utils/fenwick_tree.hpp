@@ -0,0 +1,48 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace utils {
+
+// Binary indexed tree: point updates and prefix sums in O(log size)
+template <typename T>
+class FenwickTree {
+public:
+    explicit FenwickTree(std::size_t a_size = 0) : m_tree(a_size + 1, T(0)) {}
+
+    std::size_t size() const { return m_tree.size() - 1; }
+
+    void add(std::size_t index, T delta) {
+        for (++index; index < m_tree.size(); index += index & (~index + 1)) {
+            m_tree[index] += delta;
+        }
+    }
+
+    void subtract(std::size_t index, T delta) {
+        for (++index; index < m_tree.size(); index += index & (~index + 1)) {
+            m_tree[index] -= delta;
+        }
+    }
+
+    // Sum of elements with indexes [0, count)
+    T prefix_sum(std::size_t count) const {
+        T result(0);
+        for (; count > 0; count -= count & (~count + 1)) {
+            result += m_tree[count];
+        }
+        return result;
+    }
+
+    // Sum of elements with indexes [first, last)
+    T range_sum(std::size_t first, std::size_t last) const {
+        return prefix_sum(last) - prefix_sum(first);
+    }
+
+    void clear() { std::fill(m_tree.begin(), m_tree.end(), T(0)); }
+
+private:
+    std::vector<T> m_tree;
+};
+
+}  // namespace utils
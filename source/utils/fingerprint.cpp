@@ -0,0 +1,55 @@
+#include "utils/fingerprint.hpp"
+
+#include <spdlog/fmt/fmt.h>
+
+#include "event/event.hpp"
+#include "utils/hash.hpp"
+#include "utils/summary.hpp"
+
+namespace sim {
+
+Fingerprint::Fingerprint()
+    : m_events_hash(0), m_events_count(0), m_summary_hash(0) {}
+
+void Fingerprint::add_event(const Event& event) {
+    m_events_hash = utils::hash_combine(
+        m_events_hash,
+        static_cast<std::uint64_t>(event.get_time().value_picoseconds()));
+    m_events_hash = utils::hash_combine(m_events_hash, event.get_fingerprint());
+    m_events_count++;
+}
+
+void Fingerprint::add_summary(const Summary& summary) {
+    auto combine = [this](std::uint64_t value) {
+        m_summary_hash = utils::hash_combine(m_summary_hash, value);
+    };
+    // Maps are ordered by ids, so order of flows does not depend on run.
+    // Rates and overhead are derived from hashed values and not hashed
+    // themselves: they are floating point
+    for (const auto& [connection_id, flows] : summary.get_values()) {
+        combine(utils::hash_string(connection_id));
+        for (const auto& [flow_id, flow] : flows) {
+            combine(utils::hash_string(flow_id));
+            combine(flow.added_from_conn.value_bits());
+            combine(flow.sent.value_bits());
+            combine(flow.delivered.value_bits());
+            combine(flow.packet_size.value_bits());
+            combine(flow.retransmit_size.value_bits());
+            combine(flow.retransmit_count);
+            combine(static_cast<std::uint64_t>(flow.fct.value_picoseconds()));
+        }
+    }
+}
+
+std::uint64_t Fingerprint::get_events_hash() const { return m_events_hash; }
+
+std::uint64_t Fingerprint::get_events_count() const { return m_events_count; }
+
+std::uint64_t Fingerprint::get_summary_hash() const { return m_summary_hash; }
+
+std::string Fingerprint::to_string() const {
+    return fmt::format("events {:016x} ({} events), summary {:016x}",
+                       m_events_hash, m_events_count, m_summary_hash);
+}
+
+}  // namespace sim
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace sim {
+
+class Event;
+class Summary;
+
+// Rolling hash of a simulation run: of executed events stream (time, event
+// kind, objects and packet it refers to) and of final per-flow summaries.
+// Runs of the same configuration give equal fingerprints, so comparing them
+// with golden values catches unintended changes of simulation behaviour by
+// refactorings and optimizations
+class Fingerprint {
+public:
+    Fingerprint();
+
+    // Called by scheduler right before event is executed
+    void add_event(const Event& event);
+    // Called for summaries of connections destroyed during the run and once
+    // after the run is finished
+    void add_summary(const Summary& summary);
+
+    std::uint64_t get_events_hash() const;
+    std::uint64_t get_events_count() const;
+    std::uint64_t get_summary_hash() const;
+
+    std::string to_string() const;
+
+private:
+    std::uint64_t m_events_hash;
+    std::uint64_t m_events_count;
+    std::uint64_t m_summary_hash;
+};
+
+}  // namespace sim
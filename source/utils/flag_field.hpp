@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include "bitset.hpp"
+
+namespace sim {
+
+// Returns minimal number of bits required to store given amount of values
+constexpr std::size_t required_bits_for_values(std::uint64_t values_count) {
+    std::size_t result = 0;
+    for (values_count = (values_count <= 1 ? 0 : values_count - 1);
+         values_count > 0; values_count >>= 1) {
+        ++result;
+    }
+    return result;
+}
+
+// Field of packet flags with layout known at compile time.
+// Occupies Width value bits starting from Offset and one more bit right after
+// them that marks whether the field is set in the given flags, so access is a
+// couple of shifts and masks and unset fields are reported as std::nullopt
+template <BitStorageType TBitStorage, std::size_t Offset, std::size_t Width>
+class FlagField {
+public:
+    using BitStorage = TBitStorage;
+
+    static constexpr std::size_t M_OFFSET = Offset;
+    static constexpr std::size_t M_WIDTH = Width;
+    static constexpr std::size_t M_PRESENCE_BIT = Offset + Width;
+    // First bit after the field; next field may start from it
+    static constexpr std::size_t M_END = M_PRESENCE_BIT + 1;
+
+    static_assert(Width > 0, "Flag field should have at least one bit");
+    static_assert(M_END <= sizeof_bits(TBitStorage),
+                  "Flag field does not fit into bit storage");
+
+    static constexpr TBitStorage M_MAX_VALUE =
+        (static_cast<TBitStorage>(1) << Width) - 1;
+
+    // Returns false and leaves flags unchanged if value does not fit into
+    // the field
+    static bool set(BitSet<TBitStorage>& flags, TBitStorage value) {
+        if (value > M_MAX_VALUE) {
+            return false;
+        }
+        TBitStorage bits = flags.get_bits() & ~M_FIELD_MASK;
+        bits |= (value << Offset) | M_PRESENCE_MASK;
+        flags = BitSet<TBitStorage>(bits);
+        return true;
+    }
+
+    static std::optional<TBitStorage> get(const BitSet<TBitStorage>& flags) {
+        TBitStorage bits = flags.get_bits();
+        if (!(bits & M_PRESENCE_MASK)) {
+            return std::nullopt;
+        }
+        return (bits >> Offset) & M_MAX_VALUE;
+    }
+
+    static bool is_set(const BitSet<TBitStorage>& flags) {
+        return flags.get_bits() & M_PRESENCE_MASK;
+    }
+
+    static void reset(BitSet<TBitStorage>& flags) {
+        flags = BitSet<TBitStorage>(flags.get_bits() & ~M_FIELD_MASK);
+    }
+
+private:
+    static constexpr TBitStorage M_PRESENCE_MASK = static_cast<TBitStorage>(1)
+                                                   << M_PRESENCE_BIT;
+    static constexpr TBitStorage M_FIELD_MASK =
+        (M_MAX_VALUE << Offset) | M_PRESENCE_MASK;
+};
+
+// Field that placed right after TPrevField
+template <typename TPrevField, std::size_t Width>
+using NextFlagField =
+    FlagField<typename TPrevField::BitStorage, TPrevField::M_END, Width>;
+
+}  // namespace sim
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+
+namespace utils {
+
+// Finalizer from splitmix64: cheap bijective mix with good avalanche, used to
+// spread integer header fields over all hash bits
+constexpr std::uint64_t mix64(std::uint64_t value) {
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ull;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebull;
+    value ^= value >> 31;
+    return value;
+}
+
+// Combines two hashes; order of arguments matters
+constexpr std::uint64_t hash_combine(std::uint64_t seed, std::uint64_t value) {
+    return mix64(seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) +
+                         (seed >> 2)));
+}
+
+// 64-bit FNV-1a; stable across platforms and standard library versions
+// (unlike std::hash), so routing decisions are reproducible.
+// Intended to be called once per identifier, not per packet
+constexpr std::uint64_t hash_string(std::string_view str) {
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+    for (char c : str) {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+}  // namespace utils
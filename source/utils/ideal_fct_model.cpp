@@ -0,0 +1,108 @@
+#include "utils/ideal_fct_model.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+#include "link/i_link.hpp"
+
+namespace sim {
+
+std::optional<TimeNs> IdealFctModel::get_ideal_fct(const IFlow& flow,
+                                                   SizeByte size) {
+    std::shared_ptr<IDevice> sender = flow.get_sender();
+    std::shared_ptr<IDevice> receiver = flow.get_receiver();
+    if (sender == nullptr || receiver == nullptr) {
+        return std::nullopt;
+    }
+    const SizeByte packet_size = flow.get_packet_size();
+    const auto& forward = get_path(sender, receiver, packet_size);
+    const auto& backward = get_path(receiver, sender, SizeByte(0));
+    if (!forward.has_value() || !backward.has_value()) {
+        return std::nullopt;
+    }
+    TimeNs ideal_fct = forward->latency + backward->latency;
+    if (forward->bottleneck.has_value() && packet_size != SizeByte(0)) {
+        std::uint64_t packets_count =
+            (size.value() + packet_size.value() - 1) / packet_size.value();
+        if (packets_count > 1) {
+            SizeByte pipelined_size = (packets_count - 1) * packet_size;
+            ideal_fct += pipelined_size / forward->bottleneck.value();
+        }
+    }
+    return ideal_fct;
+}
+
+const std::optional<IdealFctModel::PathProperties>& IdealFctModel::get_path(
+    const std::shared_ptr<IDevice>& from, const std::shared_ptr<IDevice>& to,
+    SizeByte packet_size) {
+    auto key = std::make_tuple(from->get_id(), to->get_id(),
+                               packet_size.value());
+    auto it = m_paths.find(key);
+    if (it == m_paths.end()) {
+        it = m_paths.emplace(key, find_path(from, to, packet_size)).first;
+    }
+    return it->second;
+}
+
+// Like routing BFS, processes devices wavefront by wavefront, so properties
+// of device are combined from all shortest paths to it before it is used
+std::optional<IdealFctModel::PathProperties> IdealFctModel::find_path(
+    const std::shared_ptr<IDevice>& from, const std::shared_ptr<IDevice>& to,
+    SizeByte packet_size) {
+    // Properties of devices from previous wavefronts
+    std::unordered_map<IDevice*, PathProperties> reached;
+    reached.emplace(from.get(), PathProperties{TimeNs(0), std::nullopt});
+    std::vector<std::shared_ptr<IDevice>> wave_front{from};
+
+    while (!wave_front.empty() && !reached.contains(to.get())) {
+        std::unordered_map<IDevice*, PathProperties> next;
+        std::vector<std::shared_ptr<IDevice>> next_wave_front;
+        for (const auto& device : wave_front) {
+            const PathProperties current = reached.at(device.get());
+            for (const auto& link : device->get_outlinks()) {
+                std::shared_ptr<IDevice> next_device = link->get_to();
+                if (next_device == nullptr ||
+                    reached.contains(next_device.get())) {
+                    continue;
+                }
+                const SpeedGbps speed = link->get_speed();
+                PathProperties candidate = current;
+                candidate.latency += link->get_propagation_delay();
+                if (speed != SpeedGbps(0)) {
+                    candidate.latency += packet_size / speed;
+                    if (!candidate.bottleneck.has_value() ||
+                        speed < candidate.bottleneck.value()) {
+                        candidate.bottleneck = speed;
+                    }
+                }
+
+                auto [it, inserted] =
+                    next.try_emplace(next_device.get(), candidate);
+                if (inserted) {
+                    next_wave_front.push_back(std::move(next_device));
+                    continue;
+                }
+                PathProperties& best = it->second;
+                if (candidate.latency < best.latency) {
+                    best.latency = candidate.latency;
+                }
+                // Unlimited path is the widest one
+                if (!candidate.bottleneck.has_value() ||
+                    (best.bottleneck.has_value() &&
+                     best.bottleneck.value() < candidate.bottleneck.value())) {
+                    best.bottleneck = candidate.bottleneck;
+                }
+            }
+        }
+        reached.merge(next);
+        wave_front = std::move(next_wave_front);
+    }
+
+    auto it = reached.find(to.get());
+    if (it == reached.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+}  // namespace sim
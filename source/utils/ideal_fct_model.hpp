@@ -0,0 +1,51 @@
+#pragma once
+
+#include <map>
+#include <optional>
+#include <tuple>
+
+#include "connection/flow/i_flow.hpp"
+#include "types.hpp"
+
+namespace sim {
+
+// Flow completion time in empty network: data is sent back to back at the
+// bottleneck speed of the path, first packet is stored and forwarded on
+// every hop and the last acknowledgement returns with propagation delay of
+// reverse path (acknowledgements are assumed to have negligible size):
+//
+//   ideal = (size - packet) / bottleneck + sum(delay + packet / speed)
+//           + sum(reverse delay)
+//
+// Size is rounded up to whole packets, as flows always send full-sized ones.
+// Routing uses shortest paths only, so the best bottleneck and latency among
+// them are taken (they may come from different paths in asymmetric
+// topologies, so the value stays a lower bound of real FCT).
+// Links with zero speed are treated as infinitely fast
+class IdealFctModel {
+public:
+    // Returns std::nullopt if receiver is unreachable from sender or back
+    std::optional<TimeNs> get_ideal_fct(const IFlow& flow, SizeByte size);
+
+private:
+    struct PathProperties {
+        // Sum of propagation and per hop transmission delays of one packet
+        TimeNs latency;
+        // std::nullopt if all links are infinitely fast
+        std::optional<SpeedGbps> bottleneck;
+    };
+
+    // Cached by (from id, to id, packet size in bytes)
+    const std::optional<PathProperties>& get_path(
+        const std::shared_ptr<IDevice>& from,
+        const std::shared_ptr<IDevice>& to, SizeByte packet_size);
+
+    static std::optional<PathProperties> find_path(
+        const std::shared_ptr<IDevice>& from,
+        const std::shared_ptr<IDevice>& to, SizeByte packet_size);
+
+    std::map<std::tuple<Id, Id, std::uint64_t>, std::optional<PathProperties>>
+        m_paths;
+};
+
+}  // namespace sim
@@ -13,6 +13,16 @@ public:
     virtual Id get_id() const = 0;
 };
 
+// Orders objects by ids: unlike ordering by addresses, iteration order of
+// containers does not depend on heap layout, so runs are reproducible
+struct IdLess {
+    template <typename T>
+    bool operator()(const std::shared_ptr<T>& lhs,
+                    const std::shared_ptr<T>& rhs) const {
+        return lhs->get_id() < rhs->get_id();
+    }
+};
+
 class IdentifierFactory {
 public:
     static IdentifierFactory& get_instance() {
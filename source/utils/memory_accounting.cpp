@@ -0,0 +1,39 @@
+#include "utils/memory_accounting.hpp"
+
+#include <spdlog/fmt/fmt.h>
+
+#include "logger/logger.hpp"
+
+namespace sim {
+
+std::string to_string(MemorySubsystem subsystem) {
+    switch (subsystem) {
+        case MemorySubsystem::Events:
+            return "events";
+        case MemorySubsystem::PacketQueues:
+            return "packet_queues";
+        case MemorySubsystem::Flows:
+            return "flows";
+        case MemorySubsystem::Metrics:
+            return "metrics";
+        case MemorySubsystem::RoutingTables:
+            return "routing_tables";
+        default:
+            LOG_ERROR(fmt::format("Undefined memory subsystem: {}",
+                                  static_cast<std::size_t>(subsystem)));
+            return "unknown";
+    }
+}
+
+std::string MemoryAccounting::to_string() {
+    std::string result;
+    for (std::size_t i = 0; i < M_SUBSYSTEMS_COUNT; i++) {
+        MemorySubsystem subsystem = static_cast<MemorySubsystem>(i);
+        result += fmt::format("{}{}: {} B (peak {} B)", (i == 0 ? "" : ", "),
+                              sim::to_string(subsystem),
+                              get_current(subsystem), get_peak(subsystem));
+    }
+    return result;
+}
+
+}  // namespace sim
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace sim {
+
+// Subsystems whose heap memory is accounted separately, so it is visible
+// which of them grows in a large run
+enum class MemorySubsystem : std::size_t {
+    // Scheduled events and event queue
+    Events,
+    // Packets stored in link queues
+    PacketQueues,
+    // Flows, their congestion control modules and packet number monitors
+    Flows,
+    // Records of metrics storages
+    Metrics,
+    // Routing tables of devices (usual and frozen)
+    RoutingTables,
+    ENUM_SIZE
+};
+
+std::string to_string(MemorySubsystem subsystem);
+
+// Counters of bytes allocated by subsystems; updated by TrackingAllocator and
+// MemoryTracked, so reading them does not traverse any structure.
+// Only memory allocated by containers and objects of a subsystem itself is
+// counted, e.g. heap buffers of id strings inside them are not
+class MemoryAccounting {
+public:
+    static void add(MemorySubsystem subsystem, std::size_t bytes) {
+        std::size_t index = static_cast<std::size_t>(subsystem);
+        m_current[index] += bytes;
+        if (m_current[index] > m_peak[index]) {
+            m_peak[index] = m_current[index];
+        }
+    }
+
+    static void remove(MemorySubsystem subsystem, std::size_t bytes) {
+        m_current[static_cast<std::size_t>(subsystem)] -= bytes;
+    }
+
+    // Bytes used by subsystem now
+    static std::size_t get_current(MemorySubsystem subsystem) {
+        return m_current[static_cast<std::size_t>(subsystem)];
+    }
+
+    // Maximal bytes used by subsystem since program start
+    static std::size_t get_peak(MemorySubsystem subsystem) {
+        return m_peak[static_cast<std::size_t>(subsystem)];
+    }
+
+    // One line with current and peak usage of all subsystems, for logs
+    static std::string to_string();
+
+private:
+    static constexpr std::size_t M_SUBSYSTEMS_COUNT =
+        static_cast<std::size_t>(MemorySubsystem::ENUM_SIZE);
+
+    static inline std::array<std::size_t, M_SUBSYSTEMS_COUNT> m_current{};
+    static inline std::array<std::size_t, M_SUBSYSTEMS_COUNT> m_peak{};
+};
+
+// Allocator for containers of a subsystem; it is stateless, so containers
+// with it behave exactly as with std::allocator
+template <typename T, MemorySubsystem Subsystem>
+class TrackingAllocator {
+public:
+    using value_type = T;
+
+    // Required as allocator has non-type template parameter
+    template <typename U>
+    struct rebind {
+        using other = TrackingAllocator<U, Subsystem>;
+    };
+
+    TrackingAllocator() = default;
+
+    template <typename U>
+    TrackingAllocator(const TrackingAllocator<U, Subsystem>&) {}
+
+    T* allocate(std::size_t n) {
+        T* ptr = std::allocator<T>().allocate(n);
+        MemoryAccounting::add(Subsystem, n * sizeof(T));
+        return ptr;
+    }
+
+    void deallocate(T* ptr, std::size_t n) {
+        MemoryAccounting::remove(Subsystem, n * sizeof(T));
+        std::allocator<T>().deallocate(ptr, n);
+    }
+
+    template <typename U>
+    bool operator==(const TrackingAllocator<U, Subsystem>&) const {
+        return true;
+    }
+};
+
+// Base class for polymorphic objects of a subsystem that are created by new
+// (e.g. with std::make_unique); counts size of the most derived object.
+// Objects created by std::make_shared are not counted, as it does not use
+// class-specific operator new
+template <MemorySubsystem Subsystem>
+class MemoryTracked {
+public:
+    static void* operator new(std::size_t size) {
+        void* ptr = ::operator new(size);
+        MemoryAccounting::add(Subsystem, size);
+        return ptr;
+    }
+
+    static void operator delete(void* ptr, std::size_t size) {
+        MemoryAccounting::remove(Subsystem, size);
+        ::operator delete(ptr, size);
+    }
+};
+
+}  // namespace sim
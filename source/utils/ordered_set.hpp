@@ -1,14 +0,0 @@
-#pragma once
-
-#include <ext/pb_ds/assoc_container.hpp>
-#include <ext/pb_ds/tree_policy.hpp>
-
-namespace utils {
-
-template <typename T>
-using ordered_set =
-    __gnu_pbds::tree<T, __gnu_pbds::null_type, std::less<T>,
-                     __gnu_pbds::rb_tree_tag,
-                     __gnu_pbds::tree_order_statistics_node_update>;
-
-}  // namespace utils
\ No newline at end of file
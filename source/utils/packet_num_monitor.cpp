@@ -1,18 +1,32 @@
 #include "packet_num_monitor.hpp"
 
+#include <algorithm>
+#include <bit>
+
 namespace sim {
-PacketNumMonitor::PacketNumMonitor() : m_confirmed(), m_first_unconfirmed(0) {}
+PacketNumMonitor::PacketNumMonitor(std::size_t a_window_size)
+    : m_bitmap(),
+      m_window_size(std::bit_ceil(std::max(a_window_size, M_WORD_BITS))),
+      m_first_unconfirmed(0) {
+    m_bitmap.assign(m_window_size / M_WORD_BITS, 0);
+}
 
 bool PacketNumMonitor::confirm_one(PacketNum packet_num) {
     if (packet_num < m_first_unconfirmed) {
         // already confirmed
         return false;
     }
-    bool confirmed = m_confirmed.insert(packet_num).second;
-    if (confirmed && packet_num == m_first_unconfirmed) {
+    if (!in_window(packet_num)) {
+        grow_window(packet_num);
+    }
+    if (test_bit(packet_num)) {
+        return false;
+    }
+    set_bit(packet_num);
+    if (packet_num == m_first_unconfirmed) {
         correctify_state();
     }
-    return confirmed;
+    return true;
 }
 
 std::size_t PacketNumMonitor::confirm_to(PacketNum packet_num) {
@@ -22,6 +36,11 @@ std::size_t PacketNumMonitor::confirm_to(PacketNum packet_num) {
         return result;
     }
 
+    // Confirmed numbers are always inside window, so there is no need to
+    // clear more than window size bits
+    std::size_t count = std::min<std::size_t>(
+        packet_num - m_first_unconfirmed + 1, m_window_size);
+    clear_range(m_first_unconfirmed, count);
     m_first_unconfirmed = packet_num + 1;
     correctify_state();
     return result;
@@ -31,7 +50,7 @@ bool PacketNumMonitor::is_confirmed(PacketNum packet_num) const {
     if (m_first_unconfirmed > packet_num) {
         return true;
     }
-    return m_confirmed.contains(packet_num);
+    return in_window(packet_num) && test_bit(packet_num);
 }
 
 std::size_t PacketNumMonitor::get_unconfirmed_count(
@@ -39,14 +58,9 @@ std::size_t PacketNumMonitor::get_unconfirmed_count(
     if (max_packet_num < m_first_unconfirmed) {
         return 0;
     }
-    std::size_t ans = max_packet_num - m_first_unconfirmed + 1;
-
-    auto it = m_confirmed.begin();
-    while (it != m_confirmed.end() && *it <= max_packet_num) {
-        it++;
-        ans--;
-    }
-    return ans;
+    std::size_t total = max_packet_num - m_first_unconfirmed + 1;
+    return total - count_confirmed(m_first_unconfirmed,
+                                   std::min(total, m_window_size));
 }
 
 std::optional<PacketNum> PacketNumMonitor::get_last_confirmed() const {
@@ -58,15 +72,86 @@ PacketNum PacketNumMonitor::get_first_unconfirmed() const {
     return m_first_unconfirmed;
 }
 
+std::size_t PacketNumMonitor::get_window_size() const { return m_window_size; }
+
 void PacketNumMonitor::correctify_state() {
-    // correctify m_first_unconfirmed
-    auto it = m_confirmed.lower_bound(m_first_unconfirmed);
-    while (it != m_confirmed.end() && *it == m_first_unconfirmed) {
-        m_first_unconfirmed++;
-        it++;
+    while (true) {
+        std::size_t bit = m_first_unconfirmed & (m_window_size - 1);
+        Word word = m_bitmap[bit / M_WORD_BITS] >> (bit % M_WORD_BITS);
+        std::size_t confirmed_run = std::countr_one(word);
+        if (confirmed_run == 0) {
+            return;
+        }
+        clear_range(m_first_unconfirmed, confirmed_run);
+        m_first_unconfirmed += confirmed_run;
+    }
+}
+
+void PacketNumMonitor::grow_window(PacketNum packet_num) {
+    std::size_t new_size = m_window_size;
+    while (packet_num - m_first_unconfirmed >= new_size) {
+        new_size *= 2;
+    }
+    decltype(m_bitmap) new_bitmap(new_size / M_WORD_BITS, 0);
+    std::size_t first_bit = m_first_unconfirmed & (m_window_size - 1);
+    for (std::size_t i = 0; i < m_bitmap.size(); i++) {
+        for (Word word = m_bitmap[i]; word != 0; word &= word - 1) {
+            std::size_t bit = i * M_WORD_BITS + std::countr_zero(word);
+            std::size_t distance = (bit - first_bit) & (m_window_size - 1);
+            std::size_t new_bit =
+                (m_first_unconfirmed + distance) & (new_size - 1);
+            new_bitmap[new_bit / M_WORD_BITS] |= Word(1)
+                                                 << (new_bit % M_WORD_BITS);
+        }
+    }
+    m_bitmap = std::move(new_bitmap);
+    m_window_size = new_size;
+}
+
+bool PacketNumMonitor::in_window(PacketNum packet_num) const {
+    return packet_num >= m_first_unconfirmed &&
+           packet_num - m_first_unconfirmed < m_window_size;
+}
+
+bool PacketNumMonitor::test_bit(PacketNum packet_num) const {
+    std::size_t bit = packet_num & (m_window_size - 1);
+    return (m_bitmap[bit / M_WORD_BITS] >> (bit % M_WORD_BITS)) & 1;
+}
+
+void PacketNumMonitor::set_bit(PacketNum packet_num) {
+    std::size_t bit = packet_num & (m_window_size - 1);
+    m_bitmap[bit / M_WORD_BITS] |= Word(1) << (bit % M_WORD_BITS);
+}
+
+template <typename TFunc>
+void PacketNumMonitor::for_each_word(PacketNum first, std::size_t count,
+                                     TFunc func) const {
+    std::size_t bit = first & (m_window_size - 1);
+    while (count > 0) {
+        std::size_t offset = bit % M_WORD_BITS;
+        std::size_t length = std::min(count, M_WORD_BITS - offset);
+        Word mask = (length == M_WORD_BITS ? ~Word(0)
+                                           : ((Word(1) << length) - 1))
+                    << offset;
+        func(bit / M_WORD_BITS, mask);
+        count -= length;
+        bit = (bit + length) & (m_window_size - 1);
     }
-    // correctify m_confirmed
-    m_confirmed.erase(m_confirmed.begin(), it);
 }
 
-}  // namespace sim
\ No newline at end of file
+std::size_t PacketNumMonitor::count_confirmed(PacketNum first,
+                                              std::size_t count) const {
+    std::size_t result = 0;
+    for_each_word(first, count, [this, &result](std::size_t index, Word mask) {
+        result += std::popcount(m_bitmap[index] & mask);
+    });
+    return result;
+}
+
+void PacketNumMonitor::clear_range(PacketNum first, std::size_t count) {
+    for_each_word(first, count, [this](std::size_t index, Word mask) {
+        m_bitmap[index] &= ~mask;
+    });
+}
+
+}  // namespace sim
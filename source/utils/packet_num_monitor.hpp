@@ -1,12 +1,24 @@
 #pragma once
+#include <cstdint>
 #include <optional>
-#include <set>
+#include <vector>
 
 #include "types.hpp"
+#include "utils/memory_accounting.hpp"
 namespace sim {
+
+// Scoreboard of confirmed packet numbers.
+// All numbers < m_first_unconfirmed are confirmed; confirmations of numbers in
+// [m_first_unconfirmed, m_first_unconfirmed + window size) are kept in a ring
+// bitmap (number n is stored in bit n % window size). Window doubles when
+// packet number does not fit into it
 class PacketNumMonitor {
 public:
-    PacketNumMonitor();
+    static constexpr std::size_t M_DEFAULT_WINDOW_SIZE = 1024;
+
+    // a_window_size is rounded up to the power of two that is at least 64
+    explicit PacketNumMonitor(
+        std::size_t a_window_size = M_DEFAULT_WINDOW_SIZE);
 
     bool confirm_one(PacketNum packet_num);
     // Returns number of packets that packet_num confirms
@@ -16,16 +28,39 @@ public:
     std::optional<PacketNum> get_last_confirmed() const;
     PacketNum get_first_unconfirmed() const;
 
+    std::size_t get_window_size() const;
+
 private:
+    using Word = std::uint64_t;
+    static constexpr std::size_t M_WORD_BITS = 64;
+
     // returns count of unconfirmed packets with numbers <= max_packet_num
-    // carefully: work slowly!
     std::size_t get_unconfirmed_count(PacketNum max_packet_num) const;
 
+    // Moves m_first_unconfirmed forward while it is confirmed
     void correctify_state();
 
-    // State: at any moment m_confirmed containts ONLY packet numbers >
-    // m_first_unconfirmed
-    std::set<PacketNum> m_confirmed;
+    // Increases window until it contains packet_num
+    void grow_window(PacketNum packet_num);
+
+    bool in_window(PacketNum packet_num) const;
+    bool test_bit(PacketNum packet_num) const;
+    void set_bit(PacketNum packet_num);
+
+    // Calls func(word, mask) for every bitmap word that contains bits of
+    // packet numbers from [first, first + count); count <= window size
+    template <typename TFunc>
+    void for_each_word(PacketNum first, std::size_t count, TFunc func) const;
+
+    // Returns number of confirmed packets in [first, first + count)
+    std::size_t count_confirmed(PacketNum first, std::size_t count) const;
+    // Clears bits of packet numbers [first, first + count)
+    void clear_range(PacketNum first, std::size_t count);
+
+    std::vector<Word, TrackingAllocator<Word, MemorySubsystem::Flows>>
+        m_bitmap;
+    // Always a power of two
+    std::size_t m_window_size;
     PacketNum m_first_unconfirmed;
 };
-}  // namespace sim
\ No newline at end of file
+}  // namespace sim
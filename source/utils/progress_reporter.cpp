@@ -0,0 +1,89 @@
+#include "utils/progress_reporter.hpp"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <algorithm>
+#include <iostream>
+
+#include "logger/logger.hpp"
+#include "utils/filesystem.hpp"
+
+namespace sim {
+
+ProgressReporter::ProgressReporter(
+    std::chrono::duration<double> a_period,
+    std::optional<std::filesystem::path> a_heartbeat_path)
+    : m_period(a_period),
+      m_start_time(Clock::now()),
+      m_last_report_time(m_start_time),
+      m_last_report_events(0) {
+    if (a_heartbeat_path.has_value()) {
+        utils::create_all_directories(a_heartbeat_path.value());
+        m_heartbeat.emplace(a_heartbeat_path.value());
+        if (!m_heartbeat.value()) {
+            LOG_ERROR(fmt::format("Can not open progress heartbeat file {}",
+                                  a_heartbeat_path.value().string()));
+            m_heartbeat.reset();
+        }
+    }
+}
+
+void ProgressReporter::report(const Progress& progress) {
+    Clock::time_point now = Clock::now();
+    double elapsed =
+        std::chrono::duration<double>(now - m_start_time).count();
+    double since_last_report =
+        std::chrono::duration<double>(now - m_last_report_time).count();
+    double events_per_second =
+        (progress.processed_events - m_last_report_events) /
+        std::max(since_last_report, 1e-9);
+
+    // Simulation speed is assumed to be the same as from the start
+    std::optional<double> completed_part;
+    std::optional<double> eta;
+    if (progress.stop_time.has_value() &&
+        progress.stop_time.value() > TimeNs(0)) {
+        completed_part = std::min(progress.simulated_time.value_nanoseconds() /
+                                      progress.stop_time->value_nanoseconds(),
+                                  1.0);
+        if (completed_part.value() > 0) {
+            eta = elapsed * (1 - completed_part.value()) /
+                  completed_part.value();
+        }
+    }
+
+    std::cerr << fmt::format(
+        "[progress] simulated {} ns ({}), {:.0f} events/s, ETA {}, {} "
+        "pending events, {} active flows\n",
+        progress.simulated_time.value_nanoseconds(),
+        (completed_part.has_value()
+             ? fmt::format("{:.1f}%", completed_part.value() * 100)
+             : "no stop time"),
+        events_per_second,
+        (eta.has_value() ? fmt::format("{:.0f}s", eta.value()) : "unknown"),
+        progress.pending_events, progress.active_flows);
+
+    if (m_heartbeat.has_value()) {
+        auto to_json = [](std::optional<double> value) {
+            return value.has_value() ? fmt::format("{}", value.value())
+                                     : std::string("null");
+        };
+        // Line is flushed at once, so monitor never reads partial line
+        m_heartbeat.value()
+            << fmt::format(
+                   "{{\"wall_time_s\": {}, \"simulated_time_ns\": {}, "
+                   "\"completed_part\": {}, \"processed_events\": {}, "
+                   "\"events_per_second\": {}, \"eta_s\": {}, "
+                   "\"pending_events\": {}, \"active_flows\": {}}}\n",
+                   elapsed, progress.simulated_time.value_nanoseconds(),
+                   to_json(completed_part), progress.processed_events,
+                   events_per_second, to_json(eta), progress.pending_events,
+                   progress.active_flows)
+            << std::flush;
+    }
+
+    m_last_report_time = now;
+    m_last_report_events = progress.processed_events;
+}
+
+}  // namespace sim
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+
+#include "types.hpp"
+
+namespace sim {
+
+// Wall clock is read only once per this number of processed events (power of
+// two), so progress reports and wall-time limit do not slow down event loop
+inline constexpr std::uint64_t WALL_CLOCK_CHECK_EVENTS = 4096;
+
+inline bool is_wall_clock_check_due(std::uint64_t processed_events) {
+    return (processed_events & (WALL_CLOCK_CHECK_EVENTS - 1)) == 0;
+}
+
+struct Progress {
+    TimeNs simulated_time;
+    // Time of scheduled stop, if any
+    std::optional<TimeNs> stop_time;
+    std::uint64_t processed_events;
+    std::size_t pending_events;
+    std::size_t active_flows;
+};
+
+// Reports progress of simulation every period of wall-clock time: prints a
+// line to stderr and appends JSON line to heartbeat file (for job monitors)
+class ProgressReporter {
+public:
+    ProgressReporter(std::chrono::duration<double> a_period,
+                     std::optional<std::filesystem::path> a_heartbeat_path);
+
+    // Called after every processed event
+    bool is_report_due(std::uint64_t processed_events) {
+        return is_wall_clock_check_due(processed_events) &&
+               Clock::now() - m_last_report_time >= m_period;
+    }
+
+    void report(const Progress& progress);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    std::chrono::duration<double> m_period;
+    std::optional<std::ofstream> m_heartbeat;
+
+    Clock::time_point m_start_time;
+    Clock::time_point m_last_report_time;
+    std::uint64_t m_last_report_events;
+};
+
+}  // namespace sim
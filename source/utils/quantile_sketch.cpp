@@ -0,0 +1,85 @@
+#include "utils/quantile_sketch.hpp"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace sim {
+
+QuantileSketch::QuantileSketch(double a_relative_accuracy)
+    : m_relative_accuracy(a_relative_accuracy),
+      m_gamma_log(0),
+      m_non_positive_count(0),
+      m_count(0),
+      m_sum(0),
+      m_min(std::numeric_limits<double>::infinity()),
+      m_max(-std::numeric_limits<double>::infinity()) {
+    if (!(m_relative_accuracy > 0 && m_relative_accuracy < 1)) {
+        throw std::invalid_argument(
+            fmt::format("Relative accuracy of quantile sketch should be in "
+                        "(0, 1); got {}",
+                        m_relative_accuracy));
+    }
+    m_gamma_log =
+        std::log1p(2 * m_relative_accuracy / (1 - m_relative_accuracy));
+}
+
+int QuantileSketch::get_bucket_index(double value) const {
+    return static_cast<int>(std::ceil(std::log(value) / m_gamma_log));
+}
+
+void QuantileSketch::add(double value) {
+    if (std::isnan(value)) {
+        return;
+    }
+    if (value > 0) {
+        m_buckets[get_bucket_index(value)]++;
+    } else {
+        m_non_positive_count++;
+    }
+    m_count++;
+    m_sum += value;
+    m_min = std::min(m_min, value);
+    m_max = std::max(m_max, value);
+}
+
+std::size_t QuantileSketch::get_count() const { return m_count; }
+
+double QuantileSketch::get_min() const {
+    return m_count == 0 ? std::nan("") : m_min;
+}
+
+double QuantileSketch::get_max() const {
+    return m_count == 0 ? std::nan("") : m_max;
+}
+
+double QuantileSketch::get_mean() const {
+    return m_count == 0 ? std::nan("") : m_sum / m_count;
+}
+
+double QuantileSketch::get_quantile(double q) const {
+    if (m_count == 0) {
+        return std::nan("");
+    }
+    q = std::clamp(q, 0.0, 1.0);
+    const double rank = q * (m_count - 1);
+    if (rank < m_non_positive_count) {
+        return std::min(m_max, 0.0);
+    }
+    std::uint64_t seen = m_non_positive_count;
+    for (const auto& [index, count] : m_buckets) {
+        seen += count;
+        if (rank < seen) {
+            // Middle of the bucket in terms of relative error
+            double value = 2 * std::exp(index * m_gamma_log) /
+                           (1 + std::exp(m_gamma_log));
+            return std::clamp(value, m_min, m_max);
+        }
+    }
+    return m_max;
+}
+
+}  // namespace sim
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+
+namespace sim {
+
+// Streaming quantile estimator with relative error guarantee (DDSketch):
+// positive values are counted in logarithmic buckets (gamma^(i-1), gamma^i]
+// with gamma = (1 + accuracy) / (1 - accuracy), so every quantile is returned
+// with relative error at most accuracy while memory depends on the range of
+// values (about ln(max / min) / (2 * accuracy) buckets), not on their count.
+// Values not greater than zero are counted in separate bucket and estimated
+// as zero
+class QuantileSketch {
+public:
+    explicit QuantileSketch(double a_relative_accuracy = 0.01);
+
+    void add(double value);
+
+    std::size_t get_count() const;
+    double get_min() const;
+    double get_max() const;
+    double get_mean() const;
+
+    // q in [0, 1]; value of rank q * (count - 1) in sorted order. Returns NaN
+    // if no values are added
+    double get_quantile(double q) const;
+
+private:
+    int get_bucket_index(double value) const;
+
+    double m_relative_accuracy;
+    double m_gamma_log;
+
+    std::map<int, std::uint64_t> m_buckets;
+    std::uint64_t m_non_positive_count;
+
+    std::size_t m_count;
+    double m_sum;
+    double m_min;
+    double m_max;
+};
+
+}  // namespace sim
@@ -0,0 +1,75 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "utils/hash.hpp"
+
+namespace sim {
+
+// Counter-based random generator (SplitMix64): i-th value of a stream is
+// mix of (stream seed + i * gamma), so the state is two integers and
+// independent streams are given by distinct keys (e.g. hash of switch id).
+// Keys are combined with global seed (--seed flag), so one number reproduces
+// or varies all random choices of the run regardless of the order in which
+// components draw values.
+// Distributions are sampled by methods below rather than std distributions:
+// algorithms of the latter are implementation-defined, so values would depend
+// on standard library
+class RandomStream {
+public:
+    using result_type = std::uint64_t;
+
+    explicit RandomStream(std::uint64_t a_key = 0)
+        : m_seed(utils::hash_combine(m_global_seed, a_key)), m_counter(0) {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()() {
+        m_counter++;
+        return utils::mix64(m_seed + m_counter * 0x9e3779b97f4a7c15ull);
+    }
+
+    // Uniform in [0, 1); unlike std::uniform_real_distribution gives the same
+    // values with every standard library
+    double next_double() { return (operator()() >> 11) * 0x1.0p-53; }
+
+    // Uniform integer in [0, bound) for positive bound: high half of
+    // value * bound (Lemire's method), with values of the biased low part
+    // rejected
+    std::uint64_t next_below(std::uint64_t bound) {
+        unsigned __int128 product =
+            static_cast<unsigned __int128>(operator()()) * bound;
+        std::uint64_t low = static_cast<std::uint64_t>(product);
+        if (low < bound) {
+            // 2^64 mod bound
+            const std::uint64_t threshold = -bound % bound;
+            while (low < threshold) {
+                product = static_cast<unsigned __int128>(operator()()) * bound;
+                low = static_cast<std::uint64_t>(product);
+            }
+        }
+        return static_cast<std::uint64_t>(product >> 64);
+    }
+
+    // Exponential with given mean by inverse CDF; next_double is less than 1,
+    // so logarithm is finite
+    double next_exponential(double mean) {
+        return -mean * std::log1p(-next_double());
+    }
+
+    // Affects streams created after the call
+    static void set_global_seed(std::uint64_t seed) { m_global_seed = seed; }
+    static std::uint64_t get_global_seed() { return m_global_seed; }
+
+private:
+    static inline std::uint64_t m_global_seed = 0;
+
+    std::uint64_t m_seed;
+    std::uint64_t m_counter;
+};
+
+}  // namespace sim
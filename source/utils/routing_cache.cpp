@@ -0,0 +1,186 @@
+#include "utils/routing_cache.hpp"
+
+#include <fcntl.h>
+#include <spdlog/fmt/fmt.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#include "logger/logger.hpp"
+#include "utils/filesystem.hpp"
+#include "utils/hash.hpp"
+
+namespace sim {
+
+const char RoutingCache::M_MAGIC[8] = {'N', 'o', 'N', 'S', 'F', 'I', 'B', '\0'};
+
+RoutingCache::RoutingCache(std::filesystem::path a_cache_dir,
+                           std::vector<std::shared_ptr<IDevice>> a_devices,
+                           std::vector<std::shared_ptr<ILink>> a_links)
+    : m_cache_dir(std::move(a_cache_dir)),
+      m_devices(std::move(a_devices)),
+      m_links(std::move(a_links)) {
+    std::sort(m_devices.begin(), m_devices.end(),
+              [](const auto& first, const auto& second) {
+                  return first->get_id() < second->get_id();
+              });
+    std::sort(m_links.begin(), m_links.end(),
+              [](const auto& first, const auto& second) {
+                  return first->get_id() < second->get_id();
+              });
+
+    m_topology_hash = utils::hash_combine(m_devices.size(), m_links.size());
+    for (std::uint32_t i = 0; i < m_devices.size(); i++) {
+        const Id& id = m_devices[i]->get_id();
+        m_device_indexes[id] = i;
+        m_topology_hash =
+            utils::hash_combine(m_topology_hash, utils::hash_string(id));
+    }
+    for (std::uint32_t i = 0; i < m_links.size(); i++) {
+        const std::shared_ptr<ILink>& link = m_links[i];
+        m_link_indexes[link.get()] = i;
+        for (const Id& id : {link->get_id(), link->get_from()->get_id(),
+                             link->get_to()->get_id()}) {
+            m_topology_hash =
+                utils::hash_combine(m_topology_hash, utils::hash_string(id));
+        }
+    }
+}
+
+std::uint64_t RoutingCache::get_topology_hash() const {
+    return m_topology_hash;
+}
+
+std::filesystem::path RoutingCache::get_file_path() const {
+    return m_cache_dir / fmt::format("{:016x}.fib", m_topology_hash);
+}
+
+bool RoutingCache::is_valid_header(const Header& header,
+                                   std::size_t file_size) const {
+    return std::memcmp(header.magic, M_MAGIC, sizeof(M_MAGIC)) == 0 &&
+           header.version == M_VERSION &&
+           header.record_size == sizeof(Record) &&
+           header.topology_hash == m_topology_hash &&
+           header.devices_count == m_devices.size() &&
+           header.links_count == m_links.size() &&
+           header.records_count ==
+               (file_size - sizeof(Header)) / sizeof(Record) &&
+           (file_size - sizeof(Header)) % sizeof(Record) == 0;
+}
+
+bool RoutingCache::is_valid_record(const Record& record) const {
+    if (record.source >= m_devices.size() ||
+        record.destination >= m_devices.size() ||
+        record.link >= m_links.size() || record.paths_count == 0) {
+        return false;
+    }
+    // Topology hash collision would be caught here
+    return m_links[record.link]->get_from() == m_devices[record.source];
+}
+
+bool RoutingCache::load() const {
+    std::filesystem::path path = get_file_path();
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        return false;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) == -1 ||
+        static_cast<std::size_t>(file_stat.st_size) < sizeof(Header)) {
+        close(fd);
+        LOG_WARN(fmt::format("Routing cache file {} is corrupted; ignored",
+                             path.string()));
+        return false;
+    }
+    std::size_t file_size = file_stat.st_size;
+    void* data = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        LOG_WARN(fmt::format("Can not map routing cache file {}; ignored",
+                             path.string()));
+        return false;
+    }
+
+    const Header* header = static_cast<const Header*>(data);
+    const Record* records = reinterpret_cast<const Record*>(header + 1);
+    bool valid = is_valid_header(*header, file_size) &&
+                 std::all_of(records, records + header->records_count,
+                             [this](const Record& record) {
+                                 return is_valid_record(record);
+                             });
+    if (!valid) {
+        munmap(data, file_size);
+        LOG_WARN(fmt::format(
+            "Routing cache file {} does not match topology; ignored",
+            path.string()));
+        return false;
+    }
+
+    for (const Record* record = records;
+         record != records + header->records_count; ++record) {
+        m_devices[record->source]->update_routing_table(
+            m_devices[record->destination]->get_id(), m_links[record->link],
+            record->paths_count);
+    }
+    munmap(data, file_size);
+    return true;
+}
+
+void RoutingCache::add_routing_table(const std::shared_ptr<IDevice>& source,
+                                     const RoutingTable& routing_table) {
+    std::uint32_t source_index = m_device_indexes.at(source->get_id());
+    for (const auto& [dest_device_id, links] : routing_table) {
+        std::uint32_t dest_index = m_device_indexes.at(dest_device_id);
+        for (const auto& [link, paths_count] : links) {
+            m_records.push_back(
+                Record{source_index, dest_index,
+                       m_link_indexes.at(link.lock().get()),
+                       static_cast<std::uint32_t>(paths_count)});
+        }
+    }
+}
+
+bool RoutingCache::store() const {
+    std::filesystem::path path = get_file_path();
+    utils::create_all_directories(path);
+
+    Header header;
+    std::memcpy(header.magic, M_MAGIC, sizeof(M_MAGIC));
+    header.version = M_VERSION;
+    header.record_size = sizeof(Record);
+    header.topology_hash = m_topology_hash;
+    header.devices_count = m_devices.size();
+    header.links_count = m_links.size();
+    header.records_count = m_records.size();
+
+    // Written to temporary file and renamed, so concurrent runs never see
+    // partially written cache
+    std::filesystem::path tmp_path = path;
+    tmp_path += fmt::format(".{}.tmp", getpid());
+    {
+        std::ofstream output(tmp_path, std::ios::binary);
+        output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        output.write(reinterpret_cast<const char*>(m_records.data()),
+                     m_records.size() * sizeof(Record));
+        if (!output) {
+            LOG_ERROR(fmt::format("Can not write routing cache file {}",
+                                  tmp_path.string()));
+            return false;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(tmp_path, path, error);
+    if (error) {
+        LOG_ERROR(fmt::format("Can not write routing cache file {}: {}",
+                              path.string(), error.message()));
+        std::filesystem::remove(tmp_path, error);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace sim
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "device/interfaces/i_device.hpp"
+#include "link/i_link.hpp"
+#include "utils/algorithms.hpp"
+
+namespace sim {
+
+// On-disk cache of routing tables built by Simulator::recalculate_paths.
+// File is named by hash of topology (device ids and links with their ends),
+// so same topology loaded again (e.g. in parameter studies) maps file instead
+// of running BFS from every device.
+//
+// File is a fixed-size header followed by array of records
+// {source device, destination device, link, paths count}; devices and links
+// are stored as indexes in lists of them sorted by id, which are same for all
+// topologies with same hash
+class RoutingCache {
+public:
+    RoutingCache(std::filesystem::path a_cache_dir,
+                 std::vector<std::shared_ptr<IDevice>> a_devices,
+                 std::vector<std::shared_ptr<ILink>> a_links);
+
+    std::uint64_t get_topology_hash() const;
+    std::filesystem::path get_file_path() const;
+
+    // Fills routing tables of devices from cache file; returns false if there
+    // is no valid file for this topology (in that case devices are unchanged)
+    bool load() const;
+
+    void add_routing_table(const std::shared_ptr<IDevice>& source,
+                           const RoutingTable& routing_table);
+
+    // Writes routing tables added by add_routing_table to cache file
+    bool store() const;
+
+private:
+    struct Record {
+        std::uint32_t source;
+        std::uint32_t destination;
+        std::uint32_t link;
+        std::uint32_t paths_count;
+    };
+
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t record_size;
+        std::uint64_t topology_hash;
+        std::uint64_t devices_count;
+        std::uint64_t links_count;
+        std::uint64_t records_count;
+    };
+
+    static const char M_MAGIC[8];
+    static const std::uint32_t M_VERSION = 1;
+
+    bool is_valid_header(const Header& header, std::size_t file_size) const;
+    bool is_valid_record(const Record& record) const;
+
+    std::filesystem::path m_cache_dir;
+    std::vector<std::shared_ptr<IDevice>> m_devices;
+    std::vector<std::shared_ptr<ILink>> m_links;
+    std::unordered_map<Id, std::uint32_t> m_device_indexes;
+    std::unordered_map<ILink*, std::uint32_t> m_link_indexes;
+    std::uint64_t m_topology_hash;
+    std::vector<Record> m_records;
+};
+
+}  // namespace sim
@@ -12,101 +12,101 @@ Summary::Summary(std::map<Id, std::map<Id, FlowSummary>> a_values)
 Summary::Summary(
     const std::unordered_set<std::shared_ptr<IConnection>>& connections) {
     for (const auto& conn : connections) {
-        Id conn_id = conn->get_id();
-        SizeByte expt_data_delivery = conn->get_total_data_added();
-        if (expt_data_delivery == SizeByte(0)) {
-            m_warnings.emplace_back(fmt::format(
-                "Connection {} has 0 expected data delivery", conn_id));
+        add_connection(conn);
+    }
+}
+
+void Summary::add_connection(const std::shared_ptr<IConnection>& conn,
+                             IdealFctModel* ideal_fct_model) {
+    Id conn_id = conn->get_id();
+    SizeByte expt_data_delivery = conn->get_total_data_added();
+    if (expt_data_delivery == SizeByte(0)) {
+        m_warnings.emplace_back(fmt::format(
+            "Connection {} has 0 expected data delivery", conn_id));
+    }
+    SizeByte real_data_delivery(0);
+    auto flows = conn->get_flows();
+
+    for (const auto& flow : flows) {
+        const SizeByte added_from_conn =
+            flow->get_total_data_size_added_from_conn();
+        const SizeByte delivered = flow->get_delivered_data_size();
+        real_data_delivery += delivered;
+
+        if (added_from_conn > delivered) {
+            m_errors.emplace_back(fmt::format(
+                "For flow {} of connection {} added from connection {} "
+                "bytes but delivered {} bytes",
+                flow->get_id(), conn_id, added_from_conn.value(),
+                delivered.value()));
         }
-        SizeByte real_data_delivery(0);
-        auto flows = conn->get_flows();
-
-        for (const auto& flow : flows) {
-            const SizeByte added_from_conn =
-                flow->get_total_data_size_added_from_conn();
-            const SizeByte delivered = flow->get_delivered_data_size();
-            real_data_delivery += delivered;
-
-            if (added_from_conn > delivered) {
-                m_errors.emplace_back(fmt::format(
-                    "For flow {} of connection {} added from connection {} "
-                    "bytes but delivered {} bytes",
-                    flow->get_id(), conn_id, added_from_conn.value(),
-                    delivered.value()));
-            }
 
-            const SizeByte sent = flow->get_sent_data_size();
-            if (sent < delivered) {
-                m_errors.emplace_back(fmt::format(
-                    "For flow {} of connection {} sent {} bytes but delivered "
-                    "{} bytes",
-                    flow->get_id(), conn_id, sent.value(), delivered.value()));
-            }
+        const SizeByte sent = flow->get_sent_data_size();
+        if (sent < delivered) {
+            m_errors.emplace_back(fmt::format(
+                "For flow {} of connection {} sent {} bytes but delivered "
+                "{} bytes",
+                flow->get_id(), conn_id, sent.value(), delivered.value()));
+        }
 
-            double overhead = delivered != SizeByte(0)
-                                  ? (sent / delivered - 1) * 100
-                                  : std::nan("");
+        double overhead = delivered != SizeByte(0)
+                              ? (sent / delivered - 1) * 100
+                              : std::nan("");
 
-            const TimeNs fct = flow->get_fct();
-            SizeByte packet_size = flow->get_packet_size();
+        const TimeNs fct = flow->get_fct();
+        SizeByte packet_size = flow->get_packet_size();
 
-            SpeedGbps sending_rate = sent / fct;
-            SpeedGbps throughput = delivered / fct;
+        SpeedGbps sending_rate = sent / fct;
+        SpeedGbps throughput = delivered / fct;
 
-            uint32_t retransmit_count = flow->retransmit_count();
-            SizeByte retransmit_size = retransmit_count * packet_size;
+        uint32_t retransmit_count = flow->retransmit_count();
+        SizeByte retransmit_size = retransmit_count * packet_size;
 
-            m_values[conn_id][flow->get_id()] =
-                FlowSummary{added_from_conn,  sent,
-                            delivered,        packet_size,
-                            overhead,         retransmit_size,
-                            retransmit_count, sending_rate,
-                            throughput,       fct};
-        }
-        if (expt_data_delivery > real_data_delivery) {
-            m_errors.emplace_back(fmt::format(
-                "For connection {} expected delivery {} but real is {}",
-                conn_id, expt_data_delivery.value(),
-                real_data_delivery.value()));
-        }
-        if (expt_data_delivery == SizeByte(0) &&
-            real_data_delivery > SizeByte(0)) {
-            m_errors.emplace_back(fmt::format(
-                "For connection {} expected delivery 0 but real is {}", conn_id,
-                real_data_delivery.value()));
+        TimeNs ideal_fct(0);
+        double slowdown = std::nan("");
+        if (ideal_fct_model != nullptr && delivered != SizeByte(0) &&
+            fct != TimeNs(0)) {
+            std::optional<TimeNs> ideal =
+                ideal_fct_model->get_ideal_fct(*flow, delivered);
+            if (ideal.has_value() && ideal.value() != TimeNs(0)) {
+                ideal_fct = ideal.value();
+                slowdown = fct / ideal_fct;
+            }
         }
-        // Case where expt_data_delivery != real_data_delivery is not
-        // always an error, because in our model, if there is less data to send
-        // than the size of the flow's packet, the flow still sends a full-sized
-        // packet.
-        // For example, if there is 1 byte to send and the packet size is 1500
-        // bytes, the flow will send a full 1500-byte packet.
-        // For this reason we do not consider this case an error.
+
+        m_values[conn_id][flow->get_id()] =
+            FlowSummary{added_from_conn,  sent,
+                        delivered,        packet_size,
+                        overhead,         retransmit_size,
+                        retransmit_count, sending_rate,
+                        throughput,       fct,
+                        ideal_fct,        slowdown};
+    }
+    if (expt_data_delivery > real_data_delivery) {
+        m_errors.emplace_back(fmt::format(
+            "For connection {} expected delivery {} but real is {}",
+            conn_id, expt_data_delivery.value(), real_data_delivery.value()));
+    }
+    if (expt_data_delivery == SizeByte(0) && real_data_delivery > SizeByte(0)) {
+        m_errors.emplace_back(fmt::format(
+            "For connection {} expected delivery 0 but real is {}", conn_id,
+            real_data_delivery.value()));
     }
+    // Case where expt_data_delivery != real_data_delivery is not always an
+    // error, because in our model, if there is less data to send than the size
+    // of the flow's packet, the flow still sends a full-sized packet.
+    // For example, if there is 1 byte to send and the packet size is 1500
+    // bytes, the flow will send a full 1500-byte packet.
+    // For this reason we do not consider this case an error.
+}
+
+const std::map<Id, std::map<Id, FlowSummary>>& Summary::get_values() const {
+    return m_values;
 }
 
 void Summary::write_to_csv(std::filesystem::path& output_path) const {
-    utils::create_all_directories(output_path);
-    std::ofstream out(output_path);
-    if (!out) {
-        throw std::runtime_error("Failed to create file for summary");
-    }
-    out << "Flow id, Packet size (bytes), Data from conn (bytes), Sent "
-           "(bytes), Delivered (bytes), "
-           "Overhead (%), Retransmit size (bytes), Retransmit count, Sending "
-           "rate (Gbps), Throughput (Gbps), FCT (ns)\n";
-    for (const auto& [conn_id, flows] : m_values) {
-        out << "\n";
-        for (const auto& [flow_id, fs] : flows) {
-            out << flow_id << ", " << fs.packet_size.value() << ", "
-                << fs.added_from_conn.value() << ", " << fs.sent.value() << ", "
-                << fs.delivered.value() << ", " << fs.overhead << ", "
-                << fs.retransmit_size.value() << ", " << fs.retransmit_count
-                << ", " << fs.sending_rate.value() << ", "
-                << fs.throughput.value() << ", " << fs.fct.value() << "\n";
-        }
-    }
-    out.close();
+    SummaryCsvWriter writer(output_path);
+    writer.write(*this);
 }
 
 void Summary::check() const {
@@ -119,4 +119,44 @@ void Summary::check() const {
             fmt::format("Summary errors: {}", fmt::join(m_errors, "\n")));
     }
 }
+
+SummaryCsvWriter::SummaryCsvWriter(const std::filesystem::path& output_path) {
+    utils::create_all_directories(output_path);
+    m_out.open(output_path);
+    if (!m_out) {
+        throw std::runtime_error("Failed to create file for summary");
+    }
+    m_out << "Flow id, Packet size (bytes), Data from conn (bytes), Sent "
+             "(bytes), Delivered (bytes), "
+             "Overhead (%), Retransmit size (bytes), Retransmit count, "
+             "Sending rate (Gbps), Throughput (Gbps), FCT (ns), Ideal FCT "
+             "(ns), Slowdown\n";
+}
+
+void SummaryCsvWriter::write(const Summary& summary) {
+    for (const auto& [conn_id, flows] : summary.get_values()) {
+        m_out << "\n";
+        for (const auto& [flow_id, fs] : flows) {
+            m_out << flow_id << ", " << fs.packet_size.value() << ", "
+                  << fs.added_from_conn.value() << ", " << fs.sent.value()
+                  << ", " << fs.delivered.value() << ", " << fs.overhead
+                  << ", " << fs.retransmit_size.value() << ", "
+                  << fs.retransmit_count << ", " << fs.sending_rate.value()
+                  << ", " << fs.throughput.value() << ", " << fs.fct.value()
+                  << ", " << fs.ideal_fct.value() << ", " << fs.slowdown
+                  << "\n";
+        }
+        m_connections_count++;
+        m_flows_count += flows.size();
+    }
+}
+
+std::size_t SummaryCsvWriter::get_connections_count() const {
+    return m_connections_count;
+}
+
+std::size_t SummaryCsvWriter::get_flows_count() const {
+    return m_flows_count;
+}
+
 }  // namespace sim
@@ -1,10 +1,13 @@
 #pragma once
 #include <filesystem>
+#include <fstream>
+#include <limits>
 #include <unordered_set>
 
 #include "connection/flow/i_flow.hpp"
 #include "connection/i_connection.hpp"
 #include "types.hpp"
+#include "utils/ideal_fct_model.hpp"
 
 namespace sim {
 
@@ -22,16 +25,29 @@ struct FlowSummary {
     SpeedGbps sending_rate{0};
     SpeedGbps throughput{0};
     TimeNs fct{0};
+    // Zero and NaN if ideal FCT is unknown (see IdealFctModel)
+    TimeNs ideal_fct{0};
+    double slowdown{std::numeric_limits<double>::quiet_NaN()};
 };
 
 // Summaryt of simulation
 // Maps flow Ids to count of delivered bytes
 class Summary {
 public:
+    Summary() = default;
     Summary(std::map<Id, std::map<Id, FlowSummary>> values);
     Summary(
         const std::unordered_set<std::shared_ptr<IConnection>>& connections);
 
+    // Adds values of connection flows; also used to capture summary of
+    // connection right before it is destroyed during simulation. Ideal FCT
+    // and slowdown of flows are filled only if ideal_fct_model is given
+    void add_connection(const std::shared_ptr<IConnection>& connection,
+                        IdealFctModel* ideal_fct_model = nullptr);
+
+    // Maps connection ids to summaries of their flows
+    const std::map<Id, std::map<Id, FlowSummary>>& get_values() const;
+
     void write_to_csv(std::filesystem::path& output_path) const;
     void check() const;
 
@@ -41,4 +57,23 @@ private:
     std::vector<WarningMessage> m_warnings;
 };
 
+// Writes rows of summaries to CSV file as they come, so summaries of
+// connections destroyed during simulation are not kept until its end
+class SummaryCsvWriter {
+public:
+    // Creates file and writes header
+    explicit SummaryCsvWriter(const std::filesystem::path& output_path);
+
+    void write(const Summary& summary);
+
+    // Counts of connections and flows of written summaries
+    std::size_t get_connections_count() const;
+    std::size_t get_flows_count() const;
+
+private:
+    std::ofstream m_out;
+    std::size_t m_connections_count = 0;
+    std::size_t m_flows_count = 0;
+};
+
 }  // namespace sim
@@ -7,7 +7,11 @@ FlowMock::FlowMock(std::shared_ptr<sim::IHost> a_receiver, SizeByte packet_size,
     : m_receiver(std::move(a_receiver)),
       m_packet_size(packet_size),
       m_sending_quota(a_sending_quota),
-      m_last_rtt(a_last_rtt) {}
+      m_last_rtt(a_last_rtt) {
+    // Flows are ordered by ids in containers, so they should be unique
+    static std::size_t mocks_count = 0;
+    m_id = "flow_mock_" + std::to_string(mocks_count++);
+}
 
 void FlowMock::update([[maybe_unused]] sim::Packet packet) {};
 
@@ -27,19 +31,20 @@ SizeByte FlowMock::get_sent_data_size() const { return SizeByte(0); }
 uint32_t FlowMock::retransmit_count() const { return 0; }
 TimeNs FlowMock::get_fct() const { return TimeNs(0); }
 
-const sim::BaseFlagManager& FlowMock::get_flag_manager() const {
-    return m_flag_manager;
-}
+void FlowMock::on_packet_lost() {}
+
+bool FlowMock::has_pending_references() const { return false; }
 
 std::shared_ptr<sim::IHost> FlowMock::get_sender() const { return nullptr; }
 std::shared_ptr<sim::IHost> FlowMock::get_receiver() const {
     return m_receiver.lock();
 }
 
-Id FlowMock::get_id() const { return ""; }
+Id FlowMock::get_id() const { return m_id; }
 
 void FlowMock::set_sending_quota(SizeByte quota) { m_sending_quota = quota; }
 void FlowMock::set_last_rtt(std::optional<TimeNs> rtt) { m_last_rtt = rtt; }
+void FlowMock::set_id(Id id) { m_id = std::move(id); }
 
 SizeByte FlowMock::get_packet_size() const { return m_packet_size; }
 
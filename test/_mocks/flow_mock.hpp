@@ -22,8 +22,9 @@ public:
     virtual SizeByte get_sent_data_size() const final;
     virtual uint32_t retransmit_count() const final;
     virtual TimeNs get_fct() const final;
+    void on_packet_lost() final;
+    bool has_pending_references() const final;
     virtual std::optional<TimeNs> get_last_rtt() const;
-    const sim::BaseFlagManager& get_flag_manager() const final;
 
     std::shared_ptr<sim::IHost> get_sender() const final;
     std::shared_ptr<sim::IHost> get_receiver() const final;
@@ -31,13 +32,14 @@ public:
     Id get_id() const final;
     void set_sending_quota(SizeByte quota);
     void set_last_rtt(std::optional<TimeNs> rtt);
+    void set_id(Id id);
 
 private:
     std::weak_ptr<sim::IHost> m_receiver;
-    sim::BaseFlagManager m_flag_manager;
     SizeByte m_packet_size;
     SizeByte m_sending_quota;
     std::optional<TimeNs> m_last_rtt;
+    Id m_id;
 };
 
 }  // namespace test
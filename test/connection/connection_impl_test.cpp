@@ -0,0 +1,63 @@
+#include "connection/connection_impl.hpp"
+
+#include <gtest/gtest.h>
+
+#include "../_mocks/flow_mock.hpp"
+
+namespace test {
+
+class ConnectionImplTest : public testing::Test {
+public:
+    void TearDown() override {
+        sim::IdentifierFactory::get_instance().clear();
+    };
+    void SetUp() override { sim::IdentifierFactory::get_instance().clear(); };
+};
+
+namespace {
+
+class SingleFlowMPLB : public sim::IMPLB {
+public:
+    void add_flow(const std::shared_ptr<sim::IFlow>& flow) final {
+        m_flow = flow;
+    };
+    void remove_flow(
+        [[maybe_unused]] const std::shared_ptr<sim::IFlow>& flow) final {
+        m_flow.reset();
+    };
+    void notify_packet_confirmed(
+        [[maybe_unused]] const std::shared_ptr<sim::IFlow>& flow) final {};
+    std::shared_ptr<sim::IFlow> select_flow() final { return m_flow; };
+    void clear_flows() final { m_flow.reset(); };
+
+private:
+    std::shared_ptr<sim::IFlow> m_flow;
+};
+
+}  // namespace
+
+TEST_F(ConnectionImplTest, CompletionIsReportedOnce) {
+    auto connection = std::make_shared<sim::ConnectionImpl>(
+        "conn", nullptr, nullptr, std::make_shared<SingleFlowMPLB>());
+    // Mock flow delivers everything it gets at once
+    auto flow = std::make_shared<FlowMock>(nullptr, SizeByte(64),
+                                           SizeByte(1024));
+    flow->set_id("flow");
+    ASSERT_TRUE(connection->add_flow(flow));
+    std::size_t completions_count = 0;
+    connection->set_completion_callback(
+        [&completions_count]() { completions_count++; });
+
+    connection->add_data_to_send(SizeByte(64));
+    for (int i = 0; i < 3; i++) {
+        connection->update(flow);
+    }
+    EXPECT_EQ(completions_count, 1);
+
+    connection->add_data_to_send(SizeByte(64));
+    connection->update(flow);
+    connection->update(flow);
+    EXPECT_EQ(completions_count, 2);
+}
+
+}  // namespace test
@@ -0,0 +1,71 @@
+#include "device/hashers/flowlet_table.hpp"
+
+#include <gtest/gtest.h>
+
+namespace test {
+
+class FlowletTableTest : public testing::Test {
+public:
+    void TearDown() override {};
+    void SetUp() override {};
+};
+
+TEST_F(FlowletTableTest, ZeroSize) {
+    EXPECT_THROW(sim::FlowletTable("", 0), std::invalid_argument);
+}
+
+TEST_F(FlowletTableTest, SameFlowHits) {
+    sim::FlowletTable table("switch", 16);
+    auto first = table.lookup(1, TimeNs(0));
+    EXPECT_TRUE(first.is_new);
+    first.entry.shift = 5;
+
+    auto second = table.lookup(1, TimeNs(10));
+    EXPECT_FALSE(second.is_new);
+    EXPECT_EQ(second.entry.shift, 5);
+    EXPECT_EQ(table.get_collisions_count(), 0);
+}
+
+TEST_F(FlowletTableTest, CollisionEvictsEntry) {
+    sim::FlowletTable table("switch", 1);
+    table.lookup(1, TimeNs(0)).entry.shift = 3;
+
+    auto other = table.lookup(2, TimeNs(1));
+    EXPECT_TRUE(other.is_new);
+    EXPECT_EQ(other.entry.shift, 0);
+    EXPECT_EQ(table.get_collisions_count(), 1);
+
+    EXPECT_TRUE(table.lookup(1, TimeNs(2)).is_new);
+    EXPECT_EQ(table.get_collisions_count(), 2);
+}
+
+TEST_F(FlowletTableTest, AgedEntryIsFree) {
+    sim::FlowletTable table("switch", 1, TimeNs(100));
+    table.lookup(1, TimeNs(0));
+    EXPECT_FALSE(table.lookup(1, TimeNs(50)).is_new);
+
+    // last_seen is not updated by lookup, so entry ages from time 0
+    EXPECT_TRUE(table.lookup(2, TimeNs(200)).is_new);
+    EXPECT_EQ(table.get_collisions_count(), 0);
+}
+
+TEST_F(FlowletTableTest, EntriesAgeByDefault) {
+    sim::FlowletTable table("switch", 1);
+    table.lookup(1, TimeNs(0));
+
+    // Finished flow does not hold slot forever, so new one is no collision
+    TimeNs after_aging = sim::FlowletTable::M_DEFAULT_AGING_TIME + TimeNs(1);
+    EXPECT_TRUE(table.lookup(2, after_aging).is_new);
+    EXPECT_EQ(table.get_collisions_count(), 0);
+}
+
+TEST_F(FlowletTableTest, EntriesDoNotAgeWithoutAgingTime) {
+    sim::FlowletTable table("switch", 1, std::nullopt);
+    table.lookup(1, TimeNs(0));
+
+    EXPECT_FALSE(table.lookup(1, Time<Second>(1)).is_new);
+    EXPECT_TRUE(table.lookup(2, Time<Second>(2)).is_new);
+    EXPECT_EQ(table.get_collisions_count(), 1);
+}
+
+}  // namespace test
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "../utils/fake_packet.hpp"
+#include "device/routing_module.hpp"
+#include "utils.hpp"
+
+namespace test {
+
+class Freeze : public testing::Test {
+public:
+    void TearDown() override {};
+    void SetUp() override {};
+};
+
+TEST_F(Freeze, SameRoundRobinOrder) {
+    int NUMBER_OF_LINKS = 4;
+    auto sources = createTestDevices(NUMBER_OF_LINKS);
+    auto dest = std::make_shared<TestDevice>();
+
+    std::vector<std::shared_ptr<TestLink>> links;
+    for (int i = 0; i < NUMBER_OF_LINKS; i++) {
+        links.emplace_back(std::make_shared<TestLink>(sources[i], dest));
+        dest->add_inlink(links.back());
+    }
+
+    std::vector<sim::ILink*> expected_order;
+    for (int i = 0; i < 2 * NUMBER_OF_LINKS; i++) {
+        expected_order.push_back(dest->next_inlink_ptr());
+    }
+
+    // move iterator from the beginning to check that freeze keeps position
+    dest->next_inlink();
+    dest->freeze();
+    for (int i = 1; i < 2 * NUMBER_OF_LINKS; i++) {
+        EXPECT_EQ(dest->next_inlink_ptr(), expected_order[i]);
+    }
+}
+
+TEST_F(Freeze, SameLinksToDestination) {
+    std::mt19937 rnd(RANDOM_SEED);
+    auto source = std::make_shared<TestDevice>("source");
+    std::vector<std::shared_ptr<sim::IDevice>> destinations;
+    std::vector<std::shared_ptr<TestLink>> links;
+    for (int i = 0; i < 3; i++) {
+        auto neighbour =
+            std::make_shared<TestDevice>("neighbour" + std::to_string(i));
+        links.emplace_back(std::make_shared<TestLink>(source, neighbour));
+        destinations.push_back(
+            std::make_shared<TestDevice>("dest" + std::to_string(i)));
+    }
+    for (std::size_t i = 0; i < destinations.size(); i++) {
+        for (std::size_t j = 0; j <= i; j++) {
+            source->update_routing_table(destinations[i]->get_id(), links[j],
+                                         j + 1);
+        }
+    }
+
+    std::vector<FakePacket> packets;
+    for (int i = 0; i < 100; i++) {
+        FakePacket packet(destinations[rnd() % destinations.size()]);
+        packet.flow_hash = rnd();
+        packets.push_back(packet);
+    }
+
+    std::vector<sim::ILink*> expected_links;
+    for (const auto& packet : packets) {
+        expected_links.push_back(source->get_link_ptr_to_destination(packet));
+    }
+
+    source->freeze();
+    for (std::size_t i = 0; i < packets.size(); i++) {
+        EXPECT_EQ(source->get_link_ptr_to_destination(packets[i]),
+                  expected_links[i]);
+    }
+
+    auto unknown = std::make_shared<TestDevice>("unknown");
+    EXPECT_EQ(source->get_link_ptr_to_destination(FakePacket(unknown)),
+              nullptr);
+}
+
+}  // namespace test
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include "device/hashers/ecmp_hasher.hpp"
+#include "device/hashers/salt_ecmp_hasher.hpp"
+#include "device/hashers/symmetric_hasher.hpp"
+#include "packet.hpp"
+#include "utils/hash.hpp"
+
+namespace test {
+
+class HashersTest : public testing::Test {
+public:
+    void TearDown() override {};
+    void SetUp() override {};
+};
+
+TEST_F(HashersTest, HeaderHashesCalculatedOnConstruction) {
+    sim::Packet packet(SizeByte(1), nullptr, "sender", "receiver");
+    EXPECT_EQ(packet.flow_hash, utils::hash_string(""));
+    EXPECT_EQ(packet.source_hash, utils::hash_string("sender"));
+    EXPECT_EQ(packet.dest_hash, utils::hash_string("receiver"));
+}
+
+TEST_F(HashersTest, ECMPDependsOnHeaderOnly) {
+    sim::ECMPHasher hasher;
+    sim::Packet first(SizeByte(1), nullptr, "sender", "receiver");
+    sim::Packet second(SizeByte(100), nullptr, "sender", "receiver");
+    second.packet_num = 10;
+    EXPECT_EQ(hasher.get_hash(first), hasher.get_hash(second));
+
+    sim::Packet reversed(SizeByte(1), nullptr, "receiver", "sender");
+    EXPECT_NE(hasher.get_hash(first), hasher.get_hash(reversed));
+}
+
+TEST_F(HashersTest, SaltDependsOnDevice) {
+    sim::SaltECMPHasher first_hasher("switch_1");
+    sim::SaltECMPHasher second_hasher("switch_2");
+    sim::Packet packet(SizeByte(1), nullptr, "sender", "receiver");
+    EXPECT_EQ(first_hasher.get_hash(packet), first_hasher.get_hash(packet));
+    EXPECT_NE(first_hasher.get_hash(packet), second_hasher.get_hash(packet));
+}
+
+TEST_F(HashersTest, SymmetricIgnoresDirection) {
+    sim::SymmetricHasher hasher;
+    sim::Packet forward(SizeByte(1), nullptr, "sender", "receiver");
+    sim::Packet backward(SizeByte(1), nullptr, "receiver", "sender");
+    EXPECT_EQ(hasher.get_hash(forward), hasher.get_hash(backward));
+
+    sim::Packet other(SizeByte(1), nullptr, "sender", "other_receiver");
+    EXPECT_NE(hasher.get_hash(forward), hasher.get_hash(other));
+}
+
+}  // namespace test
@@ -19,7 +19,11 @@ std::vector<std::shared_ptr<sim::IDevice>> createTestDevices(size_t count) {
 TestLink::TestLink(std::shared_ptr<sim::IDevice> a_src,
                    std::shared_ptr<sim::IDevice> a_dest,
                    sim::Packet packet_to_return)
-    : src(a_src), dst(a_dest), packet(packet_to_return) {}
+    : src(a_src), dst(a_dest), packet(packet_to_return) {
+    // Devices order links by ids, so they should be unique
+    static std::size_t links_count = 0;
+    m_id = "test_link_" + std::to_string(links_count++);
+}
 
 void TestLink::schedule_arrival([[maybe_unused]] sim::Packet packet) {};
 
@@ -38,6 +42,9 @@ SizeByte TestLink::get_max_to_ingress_queue_size() const {
     return SizeByte(4096);
 }
 
-Id TestLink::get_id() const { return ""; }
+SpeedGbps TestLink::get_speed() const { return SpeedGbps(1); }
+TimeNs TestLink::get_propagation_delay() const { return TimeNs(0); }
+
+Id TestLink::get_id() const { return m_id; }
 
 }  // namespace test
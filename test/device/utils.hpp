@@ -43,12 +43,16 @@ public:
     SizeByte get_to_ingress_queue_size() const final;
     SizeByte get_max_to_ingress_queue_size() const final;
 
+    SpeedGbps get_speed() const final;
+    TimeNs get_propagation_delay() const final;
+
     Id get_id() const final;
 
 private:
     std::weak_ptr<sim::IDevice> src;
     std::weak_ptr<sim::IDevice> dst;
     sim::Packet packet;
+    Id m_id;
 };
 
 }  // namespace test
@@ -0,0 +1,32 @@
+#include <gtest/gtest.h>
+
+#include "utils.hpp"
+
+namespace test {
+
+TEST_F(LinkTest, ArenaRowIsReusedWithFreshState) {
+    std::shared_ptr<sim::IDevice> src =
+        std::make_shared<DeviceMock>(DeviceMock());
+    std::shared_ptr<sim::IDevice> dst =
+        std::make_shared<DeviceMock>(DeviceMock());
+    auto link = std::make_shared<sim::Link>("old", src, dst, SpeedGbps(10),
+                                            TimeNs(10), SizeByte(4096),
+                                            SizeByte(4096));
+    // Packet is left in source egress queue of destroyed link
+    link->schedule_arrival(sim::Packet(SizeByte(100)));
+    sim::Scheduler::get_instance().clear();
+    link.reset();
+
+    auto new_link = std::make_shared<sim::Link>(
+        "new", src, dst, SpeedGbps(100), TimeNs(20), SizeByte(1024),
+        SizeByte(2048));
+    EXPECT_EQ(new_link->get_id(), "new");
+    EXPECT_EQ(new_link->get_from_egress_queue_size(), SizeByte(0));
+    EXPECT_EQ(new_link->get_max_from_egress_buffer_size(), SizeByte(1024));
+    EXPECT_EQ(new_link->get_max_to_ingress_queue_size(), SizeByte(2048));
+    EXPECT_EQ(new_link->get_speed(), SpeedGbps(100));
+    EXPECT_EQ(new_link->get_propagation_delay(), TimeNs(20));
+    EXPECT_EQ(new_link->get_to(), dst);
+}
+
+}  // namespace test
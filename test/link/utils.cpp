@@ -28,6 +28,8 @@ bool DeviceMock::update_routing_table(
 
 std::set<std::shared_ptr<sim::ILink>> DeviceMock::get_outlinks() { return {}; }
 
+void DeviceMock::freeze() {}
+
 std::shared_ptr<sim::ILink> DeviceMock::get_link_to_destination(
     [[maybe_unused]] sim::Packet packet) const {
     return nullptr;
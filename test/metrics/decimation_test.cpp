@@ -0,0 +1,56 @@
+#include "metrics/decimation.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace test {
+
+class Decimation : public testing::Test {
+public:
+    void TearDown() override {};
+    void SetUp() override {};
+};
+
+TEST_F(Decimation, ShortCurveIsNotChanged) {
+    std::vector<double> x = {0, 1, 2};
+    std::vector<double> y = {5, 3, 4};
+    sim::decimate_min_max(x, y, 3);
+    EXPECT_EQ(x, std::vector<double>({0, 1, 2}));
+    EXPECT_EQ(y, std::vector<double>({5, 3, 4}));
+}
+
+TEST_F(Decimation, KeepsPeaksAndOrder) {
+    const std::size_t points = 100'000;
+    std::vector<double> x;
+    std::vector<double> y;
+    for (std::size_t i = 0; i < points; i++) {
+        x.push_back(i);
+        y.push_back(i % 100);
+    }
+    // Single spikes are lost by uniform subsampling
+    y[31'337] = 1000;
+    y[77'777] = -1000;
+
+    sim::decimate_min_max(x, y, 500);
+    EXPECT_LE(x.size(), 500);
+    EXPECT_EQ(x.size(), y.size());
+    EXPECT_TRUE(std::is_sorted(x.begin(), x.end()));
+    EXPECT_EQ(*std::max_element(y.begin(), y.end()), 1000);
+    EXPECT_EQ(*std::min_element(y.begin(), y.end()), -1000);
+    EXPECT_NE(std::find(x.begin(), x.end(), 31'337), x.end());
+    EXPECT_NE(std::find(x.begin(), x.end(), 77'777), x.end());
+}
+
+TEST_F(Decimation, SameTime) {
+    std::vector<double> x(1000, 5);
+    std::vector<double> y;
+    for (std::size_t i = 0; i < x.size(); i++) {
+        y.push_back(i);
+    }
+    sim::decimate_min_max(x, y, 10);
+    EXPECT_EQ(y, std::vector<double>({0, 999}));
+}
+
+}  // namespace test
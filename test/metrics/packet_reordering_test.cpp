@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "metrics/packet_reordering/simple_packet_reordering.hpp"
+
+namespace test {
+
+class PacketReorderingTest : public testing::Test {
+public:
+    void TearDown() override {};
+    void SetUp() override {};
+};
+
+static int RANDOM_SEED = 42;
+
+TEST_F(PacketReorderingTest, InOrder) {
+    sim::SimplePacketReordering reordering(64);
+    for (PacketNum i = 0; i < 1000; i++) {
+        reordering.add_record(i);
+    }
+    EXPECT_EQ(reordering.value(), 0);
+}
+
+TEST_F(PacketReorderingTest, MatchesInversionsInsideWindow) {
+    std::mt19937 rnd(RANDOM_SEED);
+    const std::size_t window_size = 64;
+    const PacketNum packets_count = 2000;
+
+    // shuffle packets only locally so reordering distance is less than window
+    std::vector<PacketNum> order(packets_count);
+    std::iota(order.begin(), order.end(), 0);
+    const std::size_t block = window_size / 2;
+    for (std::size_t i = 0; i + block <= packets_count; i += block / 2) {
+        std::shuffle(order.begin() + i, order.begin() + i + block / 2, rnd);
+    }
+
+    sim::SimplePacketReordering reordering(window_size);
+    sim::PacketReordering expected = 0;
+    for (std::size_t i = 0; i < order.size(); i++) {
+        for (std::size_t j = 0; j < i; j++) {
+            expected += order[j] > order[i];
+        }
+        reordering.add_record(order[i]);
+        ASSERT_EQ(reordering.value(), expected);
+    }
+}
+
+TEST_F(PacketReorderingTest, Retransmit) {
+    sim::SimplePacketReordering reordering(64);
+    reordering.add_record(0);
+    reordering.add_record(2);
+    reordering.add_record(3);
+    // 1 is late: inverted with 2 and 3
+    reordering.add_record(1);
+    EXPECT_EQ(reordering.value(), 2);
+    // duplicate of 2 is inverted with 3 only
+    reordering.add_record(2);
+    EXPECT_EQ(reordering.value(), 3);
+}
+
+TEST_F(PacketReorderingTest, OlderThanWindow) {
+    sim::SimplePacketReordering reordering(64);
+    for (PacketNum i = 1; i <= 100; i++) {
+        reordering.add_record(i);
+    }
+    // window is [37, 100], so packet 0 is inverted with all 64 tracked packets
+    reordering.add_record(0);
+    EXPECT_EQ(reordering.value(), 64);
+}
+
+TEST_F(PacketReorderingTest, WrongWindowSize) {
+    EXPECT_THROW(sim::SimplePacketReordering(0), std::invalid_argument);
+    EXPECT_THROW(sim::SimplePacketReordering(
+                     sim::SimplePacketReordering::M_MAX_WINDOW_SIZE + 1),
+                 std::invalid_argument);
+}
+
+}  // namespace test
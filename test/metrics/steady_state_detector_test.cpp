@@ -0,0 +1,113 @@
+#include "metrics/steady_state_detector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "metrics/metrics_collector.hpp"
+
+namespace test {
+
+class SteadyStateDetectorTest : public testing::Test {
+public:
+    void TearDown() override {};
+    void SetUp() override {};
+};
+
+static int RANDOM_SEED = 42;
+
+TEST_F(SteadyStateDetectorTest, NotConvergedBeforeMinBatches) {
+    sim::SteadyStateDetector detector(sim::SteadyStateMetric::Throughput,
+                                      TimeNs(100), 10, 0.05);
+    for (int i = 0; i < 9; i++) {
+        detector.add_batch(1.0);
+        EXPECT_FALSE(detector.is_converged());
+    }
+    detector.add_batch(1.0);
+    EXPECT_TRUE(detector.is_converged());
+    EXPECT_DOUBLE_EQ(detector.get_mean(), 1.0);
+    EXPECT_DOUBLE_EQ(detector.get_half_width(), 0.0);
+}
+
+TEST_F(SteadyStateDetectorTest, HalfWidthOfKnownSample) {
+    sim::SteadyStateDetector detector(sim::SteadyStateMetric::QueueSize,
+                                      TimeNs(100), 2, 0.05);
+    // mean 5, sample variance 32 / 7; t(0.975, 7) = 2.365
+    for (double value : {2, 4, 4, 4, 5, 5, 7, 9}) {
+        detector.add_batch(value);
+    }
+    EXPECT_DOUBLE_EQ(detector.get_mean(), 5.0);
+    EXPECT_NEAR(detector.get_half_width(),
+                2.365 * std::sqrt(32.0 / 7 / 8), 0.02);
+}
+
+TEST_F(SteadyStateDetectorTest, FewBatchesGiveWideInterval) {
+    sim::SteadyStateDetector detector(sim::SteadyStateMetric::Throughput,
+                                      TimeNs(100), 2, 0.5);
+    // mean 10, sample standard deviation sqrt(2); t(0.975, 1) = 12.706
+    detector.add_batch(9);
+    detector.add_batch(11);
+    EXPECT_NEAR(detector.get_half_width(), 12.706, 0.001);
+    EXPECT_FALSE(detector.is_converged());
+}
+
+TEST_F(SteadyStateDetectorTest, ConvergesOnNoisyStationarySeries) {
+    std::mt19937 rnd(RANDOM_SEED);
+    std::normal_distribution<double> noise(10.0, 1.0);
+    sim::SteadyStateDetector detector(sim::SteadyStateMetric::Throughput,
+                                      TimeNs(100), 20, 0.02);
+    std::size_t batches = 0;
+    while (!detector.is_converged() && batches < 10000) {
+        detector.add_batch(noise(rnd));
+        batches++;
+    }
+    // Half-width 0.2 requires about (1.96 / 0.2)^2 = 96 batches
+    EXPECT_GT(batches, 50);
+    EXPECT_LT(batches, 200);
+    EXPECT_NEAR(detector.get_mean(), 10.0, 0.2);
+}
+
+TEST_F(SteadyStateDetectorTest, TimeWindow) {
+    sim::TimeWindow window{TimeNs(100), TimeNs(200)};
+    EXPECT_FALSE(window.contains(TimeNs(99)));
+    EXPECT_TRUE(window.contains(TimeNs(100)));
+    EXPECT_TRUE(window.contains(TimeNs(199)));
+    EXPECT_FALSE(window.contains(TimeNs(200)));
+
+    sim::TimeWindow warm_up{TimeNs(100), std::nullopt};
+    EXPECT_FALSE(warm_up.contains(TimeNs(0)));
+    EXPECT_TRUE(warm_up.contains(TimeNs(1'000'000'000)));
+}
+
+TEST_F(SteadyStateDetectorTest, SamplesOutsideRecordingWindowsAreDropped) {
+    sim::MetricsCollector& collector = sim::MetricsCollector::get_instance();
+    collector.set_recording_windows(
+        {{TimeNs(100), TimeNs(200)}, {TimeNs(300), std::nullopt}});
+    const Id flow_id = "recording_windows_test_flow";
+    for (int time : {50, 100, 150, 200, 250, 300, 1000}) {
+        collector.add_cwnd(flow_id, TimeNs(time), time);
+    }
+    collector.set_recording_windows({});
+
+    std::filesystem::path metrics_dir =
+        std::filesystem::temp_directory_path() / "nons_recording_windows_test";
+    collector.export_metrics_to_files(metrics_dir);
+    std::ifstream file(metrics_dir / "cwnd" / (flow_id + ".txt"));
+    ASSERT_TRUE(file.is_open());
+    std::vector<double> recorded;
+    std::string time;
+    double cwnd = 0;
+    while (file >> time >> cwnd) {
+        recorded.push_back(cwnd);
+    }
+    std::filesystem::remove_all(metrics_dir);
+    collector.remove_flow_metrics(flow_id);
+
+    EXPECT_EQ(recorded, (std::vector<double>{100, 150, 300, 1000}));
+}
+
+}  // namespace test
@@ -0,0 +1,81 @@
+#include "parser/config_reader/range_expansion.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+#include "parser/parser.hpp"
+
+namespace test {
+
+class RangeExpansion : public testing::Test {
+public:
+    void TearDown() override {
+        sim::IdentifierFactory::get_instance().clear();
+    };
+    void SetUp() override { sim::IdentifierFactory::get_instance().clear(); };
+};
+
+TEST_F(RangeExpansion, ExpandNames) {
+    EXPECT_EQ(sim::expand_names("switch"),
+              std::vector<std::string>({"switch"}));
+    EXPECT_EQ(sim::expand_names("sender[0..2]"),
+              std::vector<std::string>({"sender0", "sender1", "sender2"}));
+    EXPECT_EQ(sim::expand_names("pod[1..2]_host"),
+              std::vector<std::string>({"pod1_host", "pod2_host"}));
+    // not a range
+    EXPECT_EQ(sim::expand_names("sender[i]"),
+              std::vector<std::string>({"sender[i]"}));
+    EXPECT_THROW(sim::expand_names("sender[3..1]"), std::runtime_error);
+}
+
+TEST_F(RangeExpansion, ExpandChildren) {
+    sim::ConfigNode node(YAML::Load(R"(
+conn[1..3]:
+  sender_id: sender[i]
+  receiver_id: receiver
+  flows:
+    - flow[i]
+receiver:
+)"));
+    std::vector<std::string> names;
+    std::vector<std::string> senders;
+    sim::for_each_expanded_child(node, [&](const sim::ConfigNode& child) {
+        names.push_back(child.get_name_or_throw());
+        if (auto sender = child["sender_id"]; sender) {
+            senders.push_back(sender.value().as_or_throw<std::string>());
+            EXPECT_EQ(child.get_node()["flows"][0].as<std::string>(),
+                      "flow" + names.back().substr(4));
+        }
+    });
+    EXPECT_EQ(names, std::vector<std::string>(
+                         {"conn1", "conn2", "conn3", "receiver"}));
+    EXPECT_EQ(senders, std::vector<std::string>(
+                           {"sender1", "sender2", "sender3"}));
+}
+
+TEST_F(RangeExpansion, RangedConfig) {
+    std::filesystem::path config_path = std::filesystem::path(__FILE__)
+                                            .parent_path()
+                                            .parent_path() /
+                                        "simulator" / "topologies" /
+                                        "ranged_incast_topology.yml";
+    sim::YamlParser parser;
+    sim::Simulator simulator = parser.build_simulator_from_config(config_path);
+
+    EXPECT_EQ(simulator.get_devices().size(), 11);
+    EXPECT_EQ(simulator.get_connections().size(), 8);
+    auto& factory = sim::IdentifierFactory::get_instance();
+    // 8 * 2 links in both directions
+    EXPECT_NE(factory.get_object<sim::ILink>("senders_31"), nullptr);
+    EXPECT_EQ(factory.get_object<sim::ILink>("senders_32"), nullptr);
+    EXPECT_NE(factory.get_object<sim::ILink>("to-receiver_1"), nullptr);
+    EXPECT_NE(factory.get_object<sim::ILink>("from-receiver2"), nullptr);
+
+    for (const auto& connection : simulator.get_connections()) {
+        EXPECT_EQ(connection->get_flows().size(), 1);
+    }
+    EXPECT_NO_THROW(simulator.start());
+}
+
+}  // namespace test
@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "parser/simulation/scenario/action/action_parser.hpp"
+#include "scenario/action/on_off_action.hpp"
+#include "scenario/action/poisson_action.hpp"
+#include "scenario/action/send_data_action.hpp"
+#include "utils.hpp"
+#include "utils/hash.hpp"
+#include "utils/identifier_factory.hpp"
+#include "utils/random_stream.hpp"
+
+namespace test {
+
+static void run_all_events() {
+    while (sim::Scheduler::get_instance().tick()) {
+    }
+}
+
+TEST_F(ScenarioActions, SendDataKeepsOneEventPerConnection) {
+    auto connections = create_connections(2);
+    sim::SendDataAction action(TimeNs(5), SizeByte(100), to_weak(connections),
+                               1000, TimeNs(10), TimeNs(0));
+    action.schedule(m_simulator);
+    EXPECT_EQ(sim::Scheduler::get_instance().get_events_count(), 2);
+
+    run_all_events();
+    for (const auto& connection : connections) {
+        const auto& additions = connection->get_additions();
+        ASSERT_EQ(additions.size(), 1000);
+        for (std::size_t i = 0; i < additions.size(); i++) {
+            EXPECT_EQ(additions[i].time, TimeNs(5 + 10 * i));
+            EXPECT_EQ(additions[i].size, SizeByte(100));
+        }
+    }
+}
+
+TEST_F(ScenarioActions, SendDataJitter) {
+    auto connections = create_connections(3);
+    sim::SendDataAction action(TimeNs(0), SizeByte(100), to_weak(connections),
+                               50, TimeNs(1000), TimeNs(100));
+    action.schedule(m_simulator);
+    run_all_events();
+
+    // Same times as when all occurrences were scheduled at once
+    for (const auto& connection : connections) {
+        sim::RandomStream rng(utils::hash_string(connection->get_id()));
+        std::uniform_int_distribution<uint64_t> dist(0, 100);
+        const auto& additions = connection->get_additions();
+        ASSERT_EQ(additions.size(), 50);
+        for (std::size_t i = 0; i < additions.size(); i++) {
+            EXPECT_EQ(additions[i].time, TimeNs(1000 * i + dist(rng)));
+        }
+    }
+}
+
+TEST_F(ScenarioActions, PoissonArrivals) {
+    const std::size_t count = 20'000;
+    auto connections = create_connections(4);
+    sim::PoissonAction action(TimeNs(0), TimeNs(100), std::nullopt, count,
+                              sim::SizeDistribution::constant(SizeByte(10)),
+                              to_weak(connections), 42);
+    action.schedule(m_simulator);
+    EXPECT_EQ(sim::Scheduler::get_instance().get_events_count(), 1);
+    run_all_events();
+
+    std::size_t total_additions = 0;
+    TimeNs last_time(0);
+    for (const auto& connection : connections) {
+        std::size_t additions = connection->get_additions().size();
+        total_additions += additions;
+        // connections are chosen uniformly
+        EXPECT_NEAR(additions, count / connections.size(), count / 40);
+        last_time =
+            std::max(last_time, connection->get_additions().back().time);
+    }
+    EXPECT_EQ(total_additions, count);
+    // mean interval
+    EXPECT_NEAR(last_time.value_nanoseconds() / count, 100, 3);
+}
+
+TEST_F(ScenarioActions, PoissonUntil) {
+    auto connections = create_connections(1);
+    sim::PoissonAction action(TimeNs(1000), TimeNs(10), TimeNs(2000),
+                              std::nullopt,
+                              sim::SizeDistribution::constant(SizeByte(10)),
+                              to_weak(connections), 42);
+    action.schedule(m_simulator);
+    run_all_events();
+
+    const auto& additions = connections[0]->get_additions();
+    EXPECT_NEAR(additions.size(), 100, 30);
+    for (const auto& addition : additions) {
+        EXPECT_GT(addition.time, TimeNs(1000));
+        EXPECT_LT(addition.time, TimeNs(2000));
+    }
+}
+
+TEST_F(ScenarioActions, OnOffBursts) {
+    auto connections = create_connections(2);
+    sim::OnOffAction action(TimeNs(0), TimeNs(30), TimeNs(70), TimeNs(10), 3,
+                            sim::SizeDistribution::constant(SizeByte(10)),
+                            to_weak(connections), 42);
+    action.schedule(m_simulator);
+    EXPECT_EQ(sim::Scheduler::get_instance().get_events_count(), 1);
+    run_all_events();
+
+    std::vector<TimeNs> expected_times;
+    for (int burst = 0; burst < 3; burst++) {
+        for (int step = 0; step < 3; step++) {
+            expected_times.push_back(TimeNs(100 * burst + 10 * step));
+        }
+    }
+    for (const auto& connection : connections) {
+        std::vector<TimeNs> times;
+        for (const auto& addition : connection->get_additions()) {
+            times.push_back(addition.time);
+        }
+        EXPECT_EQ(times, expected_times);
+    }
+}
+
+TEST_F(ScenarioActions, SizeDistribution) {
+    sim::RandomStream rng(42);
+    EXPECT_EQ(sim::SizeDistribution::constant(SizeByte(1500)).sample(rng),
+              SizeByte(1500));
+
+    sim::SizeDistribution uniform({{SizeByte(1000), 0}, {SizeByte(2000), 1}});
+    EXPECT_EQ(uniform.mean(), SizeByte(1500));
+
+    sim::SizeDistribution websearch = sim::SizeDistribution::websearch();
+    const int samples = 200'000;
+    double sum = 0;
+    for (int i = 0; i < samples; i++) {
+        SizeByte size = websearch.sample(rng);
+        EXPECT_LE(size, SizeByte(30'000'000));
+        sum += size.value();
+    }
+    EXPECT_NEAR(sum / samples, websearch.mean().value(),
+                websearch.mean().value() * 0.03);
+
+    EXPECT_THROW(sim::SizeDistribution({}), std::invalid_argument);
+    EXPECT_THROW(
+        sim::SizeDistribution({{SizeByte(1000), 0.5}, {SizeByte(10), 1}}),
+        std::invalid_argument);
+    EXPECT_THROW(sim::SizeDistribution({{SizeByte(1000), 0.5}}),
+                 std::invalid_argument);
+}
+
+TEST_F(ScenarioActions, ParseGenerators) {
+    auto connections = create_connections(2);
+    for (const auto& connection : connections) {
+        sim::IdentifierFactory::get_instance().add_object(connection);
+    }
+
+    auto poisson = sim::ActionParser::parse(sim::ConfigNode(YAML::Load(R"(
+action: poisson
+when: 0ns
+mean_interval: 1000ns
+until: 1000000ns
+size_distribution:
+  - [1KB, 0.5]
+  - [100KB, 1]
+connections: conn.*
+)")));
+    EXPECT_NE(dynamic_cast<sim::PoissonAction*>(poisson.get()), nullptr);
+
+    auto on_off = sim::ActionParser::parse(sim::ConfigNode(YAML::Load(R"(
+action: on_off
+when: 0ns
+on_duration: 10000ns
+off_duration: 90000ns
+interval: 1000ns
+bursts_count: 10
+size_distribution: websearch
+connections: conn1
+)")));
+    EXPECT_NE(dynamic_cast<sim::OnOffAction*>(on_off.get()), nullptr);
+
+    // no way to stop arrivals
+    EXPECT_THROW(sim::ActionParser::parse(sim::ConfigNode(YAML::Load(R"(
+action: poisson
+when: 0ns
+mean_interval: 1000ns
+size: 1KB
+connections: conn.*
+)"))),
+                 std::runtime_error);
+    // both size and distribution
+    EXPECT_THROW(sim::ActionParser::parse(sim::ConfigNode(YAML::Load(R"(
+action: poisson
+when: 0ns
+mean_interval: 1000ns
+count: 10
+size: 1KB
+size_distribution: websearch
+connections: conn.*
+)"))),
+                 std::runtime_error);
+
+    sim::IdentifierFactory::get_instance().clear();
+}
+
+}  // namespace test
@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include "metrics/fct_report.hpp"
+#include "metrics/metrics_collector.hpp"
+#include "parser/parser.hpp"
+#include "scenario/action/trace_reader.hpp"
+#include "utils/summary.hpp"
+#include "utils.hpp"
+
+namespace test {
+
+class TraceReplay : public testing::Test {
+public:
+    void TearDown() override {
+        sim::IdentifierFactory::get_instance().clear();
+        sim::Scheduler::get_instance().clear();
+        std::filesystem::remove(m_trace_path);
+    };
+    void SetUp() override {
+        sim::IdentifierFactory::get_instance().clear();
+        m_trace_path =
+            std::filesystem::temp_directory_path() / "nons_trace_test.csv";
+    };
+
+protected:
+    void write_trace(const std::string& content) {
+        std::ofstream(m_trace_path) << content;
+    }
+
+    std::filesystem::path m_trace_path;
+};
+
+static std::filesystem::path get_config_path(const std::string& name) {
+    return std::filesystem::path(__FILE__).parent_path() / "configs" / name;
+}
+
+TEST_F(TraceReplay, ReadRecords) {
+    write_trace("time,src,dst,size\r\n5,a,b,100\r\n\n7.25,b,c,1\n");
+    sim::TraceReader reader(m_trace_path);
+
+    auto first = reader.next();
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(first->time, TimeNs(5));
+    EXPECT_EQ(first->source, "a");
+    EXPECT_EQ(first->destination, "b");
+    EXPECT_EQ(first->size, SizeByte(100));
+
+    auto second = reader.next();
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(second->time, TimeNs(7.25));
+    EXPECT_EQ(second->source, "b");
+    EXPECT_EQ(second->destination, "c");
+    EXPECT_EQ(second->size, SizeByte(1));
+
+    EXPECT_FALSE(reader.next().has_value());
+}
+
+TEST_F(TraceReplay, MalformedTrace) {
+    write_trace("5,a,b,100\n6,a,b\n");
+    sim::TraceReader reader(m_trace_path);
+    EXPECT_TRUE(reader.next().has_value());
+    EXPECT_THROW(reader.next(), std::runtime_error);
+
+    write_trace("");
+    EXPECT_FALSE(sim::TraceReader(m_trace_path).next().has_value());
+
+    EXPECT_THROW(sim::TraceReader(m_trace_path.string() + "_missing"),
+                 std::runtime_error);
+}
+
+TEST_F(TraceReplay, ConnectionsCreatedOnDemand) {
+    sim::YamlParser parser;
+    sim::Simulator simulator = parser.build_simulator_from_config(
+        get_config_path("trace_replay_simulation.yml"));
+    EXPECT_TRUE(simulator.get_connections().empty());
+
+    simulator.start();
+
+    auto& factory = sim::IdentifierFactory::get_instance();
+    EXPECT_EQ(simulator.get_connections().size(), 3);
+    EXPECT_EQ(factory.get_object<sim::IConnection>("trace_sender1_receiver")
+                  ->get_total_data_added(),
+              SizeByte(1500));
+    EXPECT_EQ(factory.get_object<sim::IConnection>("trace_sender2_receiver")
+                  ->get_total_data_added(),
+              SizeByte(2000));
+    EXPECT_EQ(factory.get_object<sim::IConnection>("trace_receiver_sender3")
+                  ->get_total_data_added(),
+              SizeByte(4096));
+}
+
+TEST_F(TraceReplay, ConnectionPerRecordDestroyedAfterCompletion) {
+    sim::YamlParser parser;
+    sim::Simulator simulator = parser.build_simulator_from_config(
+        get_config_path("trace_replay_per_record_simulation.yml"));
+
+    auto& factory = sim::IdentifierFactory::get_instance();
+    simulator.run_until(TimeNs(0));
+    std::weak_ptr<sim::IConnection> first_connection =
+        factory.get_object<sim::IConnection>("trace_sender1_receiver_1");
+    ASSERT_FALSE(first_connection.expired());
+    std::vector<std::weak_ptr<sim::IFlow>> first_flows;
+    for (const auto& flow : first_connection.lock()->get_flows()) {
+        first_flows.push_back(flow);
+    }
+    ASSERT_EQ(first_flows.size(), 1);
+
+    simulator.start();
+
+    EXPECT_TRUE(simulator.get_connections().empty());
+    EXPECT_TRUE(first_connection.expired());
+    EXPECT_TRUE(first_flows.front().expired());
+    EXPECT_EQ(factory.get_object<sim::IConnection>("trace_sender1_receiver_1"),
+              nullptr);
+
+    sim::Summary summary = simulator.get_summary();
+    EXPECT_NO_THROW(summary.check());
+    const std::map<Id, SizeByte> expected_sizes = {
+        {"trace_sender1_receiver_1", SizeByte(1000)},
+        {"trace_sender2_receiver_2", SizeByte(2000)},
+        {"trace_sender1_receiver_3", SizeByte(500)},
+        {"trace_receiver_sender3_4", SizeByte(4096)}};
+    ASSERT_EQ(summary.get_values().size(), expected_sizes.size());
+    for (const auto& [connection_id, size] : expected_sizes) {
+        ASSERT_TRUE(summary.get_values().contains(connection_id));
+        for (const auto& [flow_id, flow_summary] :
+             summary.get_values().at(connection_id)) {
+            EXPECT_EQ(flow_summary.added_from_conn, size);
+            EXPECT_GE(flow_summary.delivered, size);
+        }
+    }
+
+    // Per-flow metrics of destroyed flows are freed, so they are not exported
+    std::filesystem::path metrics_dir =
+        std::filesystem::temp_directory_path() / "nons_trace_test_metrics";
+    sim::MetricsCollector::get_instance().export_metrics_to_files(metrics_dir);
+    for (const auto& [connection_id, flows] : summary.get_values()) {
+        for (const auto& [flow_id, flow_summary] : flows) {
+            EXPECT_FALSE(std::filesystem::exists(metrics_dir / "rtt" /
+                                                 (flow_id + ".txt")))
+                << flow_id;
+        }
+    }
+    std::filesystem::remove_all(metrics_dir);
+}
+
+TEST_F(TraceReplay, DestroyedConnectionsStreamedToFctReportAndCsv) {
+    std::filesystem::path summary_path =
+        std::filesystem::temp_directory_path() / "nons_trace_test_summary.csv";
+    {
+        sim::YamlParser parser;
+        sim::Simulator simulator = parser.build_simulator_from_config(
+            get_config_path("trace_replay_per_record_simulation.yml"));
+        auto summary_writer =
+            std::make_shared<sim::SummaryCsvWriter>(summary_path);
+        simulator.set_fct_report(sim::FctReport());
+        simulator.set_summary_writer(summary_writer);
+        simulator.start();
+
+        // Flows are added to report and written at teardown instead of being
+        // kept
+        EXPECT_TRUE(simulator.get_summary().get_values().empty());
+        std::optional<sim::FctReport> report = simulator.get_fct_report();
+        ASSERT_TRUE(report.has_value());
+        EXPECT_EQ(report->get_skipped_flows_count(), 0);
+        EXPECT_EQ(report->get_total().fct_ns.get_count(), 4);
+        // All records are less than 10KB, i.e. in first default bucket
+        EXPECT_EQ(report->get_buckets()[0].fct_ns.get_count(), 4);
+        EXPECT_EQ(summary_writer->get_connections_count(), 4);
+        EXPECT_EQ(summary_writer->get_flows_count(), 4);
+    }
+
+    // File is closed with writer
+    std::ifstream summary_file(summary_path);
+    std::string line;
+    std::size_t rows_count = 0;
+    while (std::getline(summary_file, line)) {
+        rows_count += line.starts_with("trace_");
+    }
+    std::filesystem::remove(summary_path);
+    EXPECT_EQ(rows_count, 4);
+}
+
+}  // namespace test
@@ -0,0 +1,68 @@
+#include "utils.hpp"
+
+namespace test {
+
+ConnectionMock::ConnectionMock(Id a_id) : m_id(std::move(a_id)) {}
+
+Id ConnectionMock::get_id() const { return m_id; }
+
+bool ConnectionMock::add_flow(std::shared_ptr<sim::IFlow>) { return false; }
+
+bool ConnectionMock::delete_flow(std::shared_ptr<sim::IFlow>) {
+    return false;
+}
+
+void ConnectionMock::add_data_to_send(SizeByte data_size) {
+    m_additions.push_back(
+        {sim::Scheduler::get_instance().get_current_time(), data_size});
+}
+
+SizeByte ConnectionMock::get_total_data_added() const {
+    SizeByte total(0);
+    for (const auto& addition : m_additions) {
+        total += addition.size;
+    }
+    return total;
+}
+
+void ConnectionMock::update(const std::shared_ptr<sim::IFlow>&) {}
+
+bool ConnectionMock::is_completed() const { return false; }
+
+void ConnectionMock::set_completion_callback(std::function<void()>) {}
+
+sim::FlowsSet ConnectionMock::get_flows() const {
+    return {};
+}
+
+void ConnectionMock::clear_flows() {}
+
+std::shared_ptr<sim::IHost> ConnectionMock::get_sender() const {
+    return nullptr;
+}
+
+std::shared_ptr<sim::IHost> ConnectionMock::get_receiver() const {
+    return nullptr;
+}
+
+const std::vector<ConnectionMock::Addition>& ConnectionMock::get_additions()
+    const {
+    return m_additions;
+}
+
+std::vector<std::shared_ptr<ConnectionMock>> create_connections(
+    std::size_t count) {
+    std::vector<std::shared_ptr<ConnectionMock>> connections;
+    for (std::size_t i = 1; i <= count; i++) {
+        connections.push_back(
+            std::make_shared<ConnectionMock>("conn" + std::to_string(i)));
+    }
+    return connections;
+}
+
+std::vector<std::weak_ptr<sim::IConnection>> to_weak(
+    const std::vector<std::shared_ptr<ConnectionMock>>& connections) {
+    return {connections.begin(), connections.end()};
+}
+
+}  // namespace test
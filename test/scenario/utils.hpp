@@ -0,0 +1,58 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "connection/i_connection.hpp"
+#include "scheduler.hpp"
+#include "simulator.hpp"
+
+namespace test {
+
+class ScenarioActions : public testing::Test {
+public:
+    void TearDown() override { sim::Scheduler::get_instance().clear(); }
+    void SetUp() override {};
+
+protected:
+    sim::Simulator m_simulator;
+};
+
+// Remembers when and how much data was added
+class ConnectionMock : public sim::IConnection {
+public:
+    struct Addition {
+        TimeNs time;
+        SizeByte size;
+    };
+
+    explicit ConnectionMock(Id a_id);
+
+    Id get_id() const final;
+    bool add_flow(std::shared_ptr<sim::IFlow> flow) final;
+    bool delete_flow(std::shared_ptr<sim::IFlow> flow) final;
+    void add_data_to_send(SizeByte data_size) final;
+    SizeByte get_total_data_added() const final;
+    void update(const std::shared_ptr<sim::IFlow>& flow) final;
+    bool is_completed() const final;
+    void set_completion_callback(std::function<void()> callback) final;
+    sim::FlowsSet get_flows() const final;
+    void clear_flows() final;
+    std::shared_ptr<sim::IHost> get_sender() const final;
+    std::shared_ptr<sim::IHost> get_receiver() const final;
+
+    const std::vector<Addition>& get_additions() const;
+
+private:
+    Id m_id;
+    std::vector<Addition> m_additions;
+};
+
+std::vector<std::shared_ptr<ConnectionMock>> create_connections(
+    std::size_t count);
+
+std::vector<std::weak_ptr<sim::IConnection>> to_weak(
+    const std::vector<std::shared_ptr<ConnectionMock>>& connections);
+
+}  // namespace test
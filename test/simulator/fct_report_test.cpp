@@ -0,0 +1,55 @@
+#include "metrics/fct_report.hpp"
+
+#include <gtest/gtest.h>
+
+#include "utils.hpp"
+
+namespace test {
+
+class FctReport : public SimulatorTest {};
+
+TEST_F(FctReport, SlowdownOfFlowInEmptyNetwork) {
+    sim::Simulator simulator = build_simulator(SINGLE_FLOW_TOPOLOGY);
+    simulator.start();
+    sim::Summary summary = simulator.get_summary();
+    const sim::FlowSummary& flow =
+        summary.get_values().at("conn").at("conn_flow");
+
+    // Nine packets are pipelined behind the first one, which is stored and
+    // forwarded on two hops; four links on the way there and back
+    const TimeNs packet_transmission = SizeByte(1024) / SpeedGbps(100);
+    const TimeNs expected_ideal_fct = 11 * packet_transmission + 4 * TimeNs(10);
+    EXPECT_NEAR(flow.ideal_fct.value_nanoseconds(),
+                expected_ideal_fct.value_nanoseconds(), 0.01);
+    // Real FCT also includes acknowledgement transmission and processing
+    EXPECT_GE(flow.slowdown, 1);
+    EXPECT_LT(flow.slowdown, 1.01);
+
+    sim::FctReport report;
+    report.add_summary(summary);
+    // 10KB is the lower bound of second default bucket
+    EXPECT_EQ(report.get_buckets()[0].fct_ns.get_count(), 0);
+    EXPECT_EQ(report.get_buckets()[1].fct_ns.get_count(), 1);
+    EXPECT_EQ(report.get_total().slowdown.get_count(), 1);
+    EXPECT_DOUBLE_EQ(report.get_total().slowdown.get_quantile(0.99),
+                     flow.slowdown);
+}
+
+TEST_F(FctReport, FlowsWithoutDeliveredDataAreSkipped) {
+    sim::FlowSummary idle;
+    sim::FlowSummary completed;
+    completed.delivered = Size<KByte>(100);
+    completed.fct = TimeNs(1000);
+    completed.slowdown = 2;
+
+    sim::FctReport report;
+    report.add_summary(sim::Summary(
+        {{"conn", {{"idle", idle}, {"completed", completed}}}}));
+
+    EXPECT_EQ(report.get_skipped_flows_count(), 1);
+    // 100KB is the lower bound of third default bucket
+    EXPECT_EQ(report.get_buckets()[2].fct_ns.get_count(), 1);
+    EXPECT_DOUBLE_EQ(report.get_total().slowdown.get_quantile(0.5), 2);
+}
+
+}  // namespace test
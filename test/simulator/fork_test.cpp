@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include "scenario/action/send_data_action.hpp"
+#include "utils.hpp"
+
+namespace test {
+
+class Fork : public SimulatorTest {};
+
+static std::shared_ptr<sim::IConnection> get_connection(const Id& id) {
+    return sim::IdentifierFactory::get_instance()
+        .get_object<sim::IConnection>(id);
+}
+
+TEST_F(Fork, RunUntil) {
+    sim::Simulator simulator = build_simulator(RANGED_INCAST_TOPOLOGY);
+    simulator.run_until(TimeNs(45));
+    EXPECT_EQ(get_connection("conn4")->get_total_data_added(), SizeByte(1024));
+    EXPECT_EQ(get_connection("conn5")->get_total_data_added(), SizeByte(0));
+
+    simulator.start();
+    EXPECT_EQ(get_connection("conn5")->get_total_data_added(), SizeByte(1024));
+    EXPECT_EQ(get_connection("conn8")->get_total_data_added(), SizeByte(1024));
+}
+
+TEST_F(Fork, BranchesShareWarmUp) {
+    sim::Simulator simulator = build_simulator(RANGED_INCAST_TOPOLOGY);
+    std::optional<std::size_t> branch = simulator.fork_at(TimeNs(45), 2);
+    if (!branch.has_value()) {
+        // parent: both branches exited successfully
+        return;
+    }
+    // Branch checks its results itself and reports them by exit code, as
+    // state of branches is not visible to parent
+    if (branch.value() == 1) {
+        sim::Scenario scenario;
+        scenario.add_action(std::make_unique<sim::SendDataAction>(
+            TimeNs(100), SizeByte(2048),
+            std::vector<std::weak_ptr<sim::IConnection>>{
+                get_connection("conn1")},
+            1, TimeNs(0), TimeNs(0)));
+        simulator.add_scenario(std::move(scenario));
+    }
+    simulator.start();
+    SizeByte expected_conn1 = SizeByte(branch.value() == 1 ? 3072 : 1024);
+    bool correct =
+        get_connection("conn1")->get_total_data_added() == expected_conn1 &&
+        get_connection("conn8")->get_total_data_added() == SizeByte(1024);
+    // gtest must not continue in child process
+    _exit(correct ? 0 : 1);
+}
+
+TEST_F(Fork, FailedBranchReported) {
+    sim::Simulator simulator = build_simulator(RANGED_INCAST_TOPOLOGY);
+    std::optional<std::size_t> branch;
+    bool thrown = false;
+    try {
+        branch = simulator.fork_at(TimeNs(45), 2);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    if (branch.has_value()) {
+        _exit(branch.value() == 0 ? 0 : 1);
+    }
+    EXPECT_TRUE(thrown);
+}
+
+TEST_F(Fork, ZeroBranchesRejected) {
+    sim::Simulator simulator = build_simulator(RANGED_INCAST_TOPOLOGY);
+    EXPECT_THROW(simulator.fork_at(TimeNs(45), 0), std::invalid_argument);
+    // Warm-up is not run before the check
+    EXPECT_EQ(get_connection("conn1")->get_total_data_added(), SizeByte(0));
+}
+
+}  // namespace test
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+#include "parser/parser.hpp"
+#include "utils.hpp"
+
+namespace test {
+
+class TopologyGenerator : public testing::Test {
+public:
+    void TearDown() override {
+        sim::IdentifierFactory::get_instance().clear();
+    };
+    void SetUp() override { sim::IdentifierFactory::get_instance().clear(); };
+};
+
+static sim::Simulator build_generated(const std::string& topology_name) {
+    std::filesystem::path current_file_path = __FILE__;
+    sim::YamlParser parser;
+    return parser.build_simulator_from_config(
+        current_file_path.parent_path() / "topologies" /
+        ("generated_" + topology_name + "_topology.yml"));
+}
+
+static bool has_device(const sim::Simulator& simulator, const Id& id) {
+    for (const auto& device : simulator.get_devices()) {
+        if (device->get_id() == id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+TEST_F(TopologyGenerator, FatTree) {
+    sim::Simulator simulator = build_generated("fat_tree");
+    // k = 4: 16 hosts, 4 core, 8 aggregation and 8 edge switches
+    EXPECT_EQ(simulator.get_devices().size(), 36);
+    EXPECT_TRUE(has_device(simulator, "pod4_host4"));
+    EXPECT_TRUE(has_device(simulator, "pod1_edge2"));
+    EXPECT_TRUE(has_device(simulator, "core4"));
+    // edge-host, aggr-edge and aggr-core links in both directions
+    auto& factory = sim::IdentifierFactory::get_instance();
+    EXPECT_NE(factory.get_object<sim::ILink>("link_95"), nullptr);
+    EXPECT_EQ(factory.get_object<sim::ILink>("link_96"), nullptr);
+}
+
+TEST_F(TopologyGenerator, Fractal) {
+    sim::Simulator simulator = build_generated("fractal");
+    // sender, 2 receivers, 2 + 4 switches
+    EXPECT_EQ(simulator.get_devices().size(), 9);
+    EXPECT_TRUE(has_device(simulator, "switch-2-1"));
+    EXPECT_TRUE(has_device(simulator, "receiver-2"));
+}
+
+TEST_F(TopologyGenerator, LeafSpine) {
+    sim::Simulator simulator = build_generated("leaf_spine");
+    EXPECT_EQ(simulator.get_devices().size(), 11);
+    EXPECT_TRUE(has_device(simulator, "spine2"));
+    EXPECT_TRUE(has_device(simulator, "leaf3_host2"));
+}
+
+TEST_F(TopologyGenerator, Dragonfly) {
+    sim::Simulator simulator = build_generated("dragonfly");
+    // 5 groups of 2 routers with 1 host each
+    EXPECT_EQ(simulator.get_devices().size(), 20);
+    EXPECT_TRUE(has_device(simulator, "group5_router2_host1"));
+}
+
+}  // namespace test
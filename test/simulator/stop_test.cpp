@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include "metrics/steady_state_detector.hpp"
+#include "scenario/action/send_data_action.hpp"
+#include "utils.hpp"
+
+namespace test {
+
+class StopCondition : public SimulatorTest {};
+
+TEST_F(StopCondition, StopOnCompletion) {
+    TimeNs full_run_end_time(0);
+    {
+        sim::Simulator simulator = build_simulator(RANGED_INCAST_TOPOLOGY);
+        simulator.start();
+        full_run_end_time = sim::Scheduler::get_instance().get_current_time();
+    }
+
+    sim::Simulator simulator = build_simulator(RANGED_INCAST_TOPOLOGY);
+    simulator.set_stop_on_completion(true);
+    simulator.start();
+    for (const auto& connection : simulator.get_connections()) {
+        EXPECT_TRUE(connection->is_completed()) << connection->get_id();
+    }
+    EXPECT_TRUE(full_run_end_time >
+                sim::Scheduler::get_instance().get_current_time());
+    EXPECT_EQ(sim::Scheduler::get_instance().get_events_count(), 0);
+}
+
+TEST_F(StopCondition, WallTimeLimit) {
+    sim::Simulator simulator = build_simulator(RANGED_INCAST_TOPOLOGY);
+    auto conn1 = sim::IdentifierFactory::get_instance()
+                     .get_object<sim::IConnection>("conn1");
+    sim::Scenario scenario;
+    scenario.add_action(std::make_unique<sim::SendDataAction>(
+        TimeNs(0), SizeByte(100'000'000),
+        std::vector<std::weak_ptr<sim::IConnection>>{conn1}, 1, TimeNs(0),
+        TimeNs(0)));
+    simulator.add_scenario(std::move(scenario));
+    simulator.set_wall_time_limit(std::chrono::seconds(0));
+    simulator.start();
+
+    EXPECT_FALSE(conn1->is_completed());
+    EXPECT_TRUE(sim::is_wall_clock_check_due(
+        sim::Scheduler::get_instance().get_processed_events_count()));
+}
+
+TEST_F(StopCondition, SteadyStateReached) {
+    sim::Simulator simulator = build_simulator(RANGED_INCAST_TOPOLOGY);
+    auto conn1 = sim::IdentifierFactory::get_instance()
+                     .get_object<sim::IConnection>("conn1");
+    sim::Scenario scenario;
+    scenario.add_action(std::make_unique<sim::SendDataAction>(
+        TimeNs(0), SizeByte(100'000'000),
+        std::vector<std::weak_ptr<sim::IConnection>>{conn1}, 1, TimeNs(0),
+        TimeNs(0)));
+    simulator.add_scenario(std::move(scenario));
+    simulator.set_steady_state_detector(
+        sim::SteadyStateDetector(sim::SteadyStateMetric::Throughput,
+                                 Time<Microsecond>(1), 5, 0.1),
+        Time<Microsecond>(10));
+    simulator.start();
+
+    const auto& detector = simulator.get_steady_state_detector();
+    ASSERT_TRUE(detector.has_value());
+    EXPECT_TRUE(detector->is_converged());
+    EXPECT_GE(detector->get_batches_count(), 5);
+    // Run is stopped long before 100MB are sent
+    EXPECT_FALSE(conn1->is_completed());
+    EXPECT_EQ(sim::Scheduler::get_instance().get_events_count(), 0);
+}
+
+}  // namespace test
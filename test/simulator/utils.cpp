@@ -1,9 +1,21 @@
 #include "utils.hpp"
 
+#include <filesystem>
+
+#include "parser/parser.hpp"
 #include "simulator.hpp"
 
 namespace test {
 
+sim::Simulator build_simulator(const std::string& topology_name) {
+    sim::IdentifierFactory::get_instance().clear();
+    std::filesystem::path config_path =
+        std::filesystem::path(__FILE__).parent_path() / "topologies" /
+        topology_name;
+    sim::YamlParser parser;
+    return parser.build_simulator_from_config(config_path);
+}
+
 sim::Simulator::AddResult add_two_way_links(
     sim::Simulator& sim, std::initializer_list<two_way_link_t> links) {
     static std::uint32_t link_index = 0;
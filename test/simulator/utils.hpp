@@ -1,14 +1,38 @@
 #pragma once
 
+#include <gtest/gtest.h>
+
 #include <expected>
 #include <initializer_list>
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "simulator.hpp"
 
 namespace test {
 
+// Fixture of tests that run simulations: clears identifiers and events left
+// by them
+class SimulatorTest : public testing::Test {
+public:
+    void TearDown() override {
+        sim::IdentifierFactory::get_instance().clear();
+        sim::Scheduler::get_instance().clear();
+    };
+    void SetUp() override { sim::IdentifierFactory::get_instance().clear(); };
+};
+
+// 8 connections conn1..conn8; conn<i> gets 1024B at i * 10ns
+inline const std::string RANGED_INCAST_TOPOLOGY = "ranged_incast_topology.yml";
+// Single flow sends 10 packets of 1024B from sender to receiver through
+// switch; links are 100Gbps with 10ns latency
+inline const std::string SINGLE_FLOW_TOPOLOGY = "single_flow_topology.yml";
+
+// Builds simulator from config placed in test/simulator/topologies;
+// identifiers of previously built simulators are cleared
+sim::Simulator build_simulator(const std::string& topology_name);
+
 using two_way_link_t =
     std::pair<std::shared_ptr<sim::IDevice>, std::shared_ptr<sim::IDevice>>;
 
@@ -2,7 +2,11 @@
 
 LinkMock::LinkMock(std::weak_ptr<sim::IDevice> a_from,
                    std::weak_ptr<sim::IDevice> a_to)
-    : m_from(a_from), m_to(a_to), m_arrived_packets(), m_ingress_packet() {}
+    : m_from(a_from), m_to(a_to), m_arrived_packets(), m_ingress_packet() {
+    // Devices order links by ids, so they should be unique
+    static std::size_t mocks_count = 0;
+    m_id = "link_mock_" + std::to_string(mocks_count++);
+}
 
 std::shared_ptr<sim::IDevice> LinkMock::get_from() const {
     return m_from.lock();
@@ -33,4 +37,7 @@ SizeByte LinkMock::get_max_from_egress_buffer_size() const {
 SizeByte LinkMock::get_to_ingress_queue_size() const { return SizeByte(0); }
 SizeByte LinkMock::get_max_to_ingress_queue_size() const { return SizeByte(0); }
 
-Id LinkMock::get_id() const { return ""; }
+SpeedGbps LinkMock::get_speed() const { return SpeedGbps(1); }
+TimeNs LinkMock::get_propagation_delay() const { return TimeNs(0); }
+
+Id LinkMock::get_id() const { return m_id; }
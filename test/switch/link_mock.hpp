@@ -22,6 +22,9 @@ public:
     virtual SizeByte get_to_ingress_queue_size() const final;
     virtual SizeByte get_max_to_ingress_queue_size() const final;
 
+    virtual SpeedGbps get_speed() const final;
+    virtual TimeNs get_propagation_delay() const final;
+
     void set_ingress_packet(sim::Packet a_paket);
     std::vector<sim::Packet> get_arrived_packets() const;
 
@@ -32,4 +35,5 @@ private:
     std::weak_ptr<sim::IDevice> m_to;
     std::vector<sim::Packet> m_arrived_packets;
     std::optional<sim::Packet> m_ingress_packet;
+    Id m_id;
 };
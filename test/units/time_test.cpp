@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include "types.hpp"
+#include "units/units.hpp"
+
+namespace test {
+
+class TimeTest : public testing::Test {
+public:
+    void TearDown() override {};
+    void SetUp() override {};
+};
+
+TEST_F(TimeTest, Conversions) {
+    EXPECT_EQ(TimeNs(Time<Microsecond>(1.5)), TimeNs(1500));
+    EXPECT_EQ(TimeNs(Time<Second>(2)).value_picoseconds(), 2'000'000'000'000);
+    EXPECT_DOUBLE_EQ(TimeNs(0.25).value_nanoseconds(), 0.25);
+    EXPECT_DOUBLE_EQ(Time<Microsecond>(TimeNs(2500)).value(), 2.5);
+    EXPECT_EQ(TimeNs::from_picoseconds(1500), TimeNs(1.5));
+    // rounded to the nearest picosecond
+    EXPECT_EQ(TimeNs(0.0004).value_picoseconds(), 0);
+    EXPECT_EQ(TimeNs(0.0006).value_picoseconds(), 1);
+    EXPECT_EQ(TimeNs(-0.0006).value_picoseconds(), -1);
+}
+
+TEST_F(TimeTest, ExactAccumulation) {
+    // 0.1 ns is not representable as double, but sum of picoseconds is exact
+    TimeNs time(0);
+    for (int i = 0; i < 1'000'000; i++) {
+        time += TimeNs(0.1);
+    }
+    EXPECT_EQ(time, TimeNs(100'000));
+    EXPECT_EQ(time.value_picoseconds(), 100'000'000);
+}
+
+TEST_F(TimeTest, Comparison) {
+    TimeNs time(10);
+    EXPECT_LT(time, time + TimeNs::from_picoseconds(1));
+    EXPECT_GT(time, time - TimeNs::from_picoseconds(1));
+    EXPECT_NE(time, time + TimeNs::from_picoseconds(1));
+    EXPECT_EQ(time * 2.5, TimeNs(25));
+    EXPECT_EQ(time / 4, TimeNs(2.5));
+    EXPECT_DOUBLE_EQ(time / TimeNs(4), 2.5);
+}
+
+TEST_F(TimeTest, TransmissionDelay) {
+    EXPECT_EQ(SizeByte(1024) / SpeedGbps(1), TimeNs(8 * 1024 / 1.073741824));
+}
+
+}  // namespace test
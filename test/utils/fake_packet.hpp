@@ -9,6 +9,7 @@ namespace test {
 struct FakePacket : public sim::Packet {
     FakePacket(std::shared_ptr<sim::IDevice> device) {
         dest_id = device->get_id();
+        update_header_hashes();
     };
 };
 
@@ -0,0 +1,43 @@
+#include "utils/fenwick_tree.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace test {
+
+class FenwickTreeTest : public testing::Test {
+public:
+    void TearDown() override {};
+    void SetUp() override {};
+};
+
+static int RANDOM_SEED = 42;
+
+TEST_F(FenwickTreeTest, MatchesPrefixSums) {
+    std::mt19937 rnd(RANDOM_SEED);
+    const std::size_t size = 100;
+    utils::FenwickTree<int> tree(size);
+    std::vector<int> values(size, 0);
+
+    for (int step = 0; step < 1000; step++) {
+        std::size_t index = rnd() % size;
+        int delta = static_cast<int>(rnd() % 21) - 10;
+        tree.add(index, delta);
+        values[index] += delta;
+
+        std::size_t first = rnd() % size;
+        std::size_t last = first + rnd() % (size - first + 1);
+        int expected = 0;
+        for (std::size_t i = first; i < last; i++) {
+            expected += values[i];
+        }
+        ASSERT_EQ(tree.range_sum(first, last), expected);
+    }
+
+    tree.clear();
+    EXPECT_EQ(tree.prefix_sum(size), 0);
+}
+
+}  // namespace test
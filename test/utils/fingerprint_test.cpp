@@ -0,0 +1,94 @@
+#include "utils/fingerprint.hpp"
+
+#include <gtest/gtest.h>
+
+#include "scheduler.hpp"
+#include "utils/summary.hpp"
+
+namespace test {
+
+class Fingerprint : public testing::Test {
+public:
+    void TearDown() override {
+        sim::Scheduler::get_instance().clear();
+        sim::Scheduler::get_instance().disable_fingerprint();
+    };
+    void SetUp() override {};
+};
+
+namespace {
+
+struct MarkedEvent : public sim::Event {
+    MarkedEvent(TimeNs a_time, std::uint64_t a_mark)
+        : Event(a_time), mark(a_mark) {}
+    void operator()() final {}
+    std::uint64_t get_fingerprint() const final { return mark; }
+
+    std::uint64_t mark;
+};
+
+}  // namespace
+
+TEST_F(Fingerprint, EventsOrderMatters) {
+    sim::Fingerprint first;
+    first.add_event(MarkedEvent(TimeNs(1), 1));
+    first.add_event(MarkedEvent(TimeNs(1), 2));
+
+    sim::Fingerprint same;
+    same.add_event(MarkedEvent(TimeNs(1), 1));
+    same.add_event(MarkedEvent(TimeNs(1), 2));
+
+    sim::Fingerprint reordered;
+    reordered.add_event(MarkedEvent(TimeNs(1), 2));
+    reordered.add_event(MarkedEvent(TimeNs(1), 1));
+
+    sim::Fingerprint other_time;
+    other_time.add_event(MarkedEvent(TimeNs(1), 1));
+    other_time.add_event(MarkedEvent(TimeNs(2), 2));
+
+    EXPECT_EQ(first.get_events_count(), 2);
+    EXPECT_EQ(first.get_events_hash(), same.get_events_hash());
+    EXPECT_NE(first.get_events_hash(), reordered.get_events_hash());
+    EXPECT_NE(first.get_events_hash(), other_time.get_events_hash());
+}
+
+TEST_F(Fingerprint, SchedulerHashesExecutedEvents) {
+    sim::Scheduler& scheduler = sim::Scheduler::get_instance();
+    EXPECT_FALSE(scheduler.get_fingerprint().has_value());
+
+    scheduler.enable_fingerprint();
+    scheduler.add<MarkedEvent>(TimeNs(2), 2);
+    scheduler.add<MarkedEvent>(TimeNs(1), 1);
+    while (scheduler.tick()) {
+    }
+
+    sim::Fingerprint expected;
+    expected.add_event(MarkedEvent(TimeNs(1), 1));
+    expected.add_event(MarkedEvent(TimeNs(2), 2));
+    ASSERT_TRUE(scheduler.get_fingerprint().has_value());
+    EXPECT_EQ(scheduler.get_fingerprint()->get_events_hash(),
+              expected.get_events_hash());
+    EXPECT_EQ(scheduler.get_fingerprint()->get_events_count(), 2);
+}
+
+TEST_F(Fingerprint, SummaryValues) {
+    sim::FlowSummary flow;
+    flow.delivered = SizeByte(1024);
+    flow.fct = TimeNs(100);
+    sim::Summary summary({{"conn", {{"flow", flow}}}});
+
+    flow.fct = TimeNs(101);
+    sim::Summary other_summary({{"conn", {{"flow", flow}}}});
+
+    sim::Fingerprint first;
+    first.add_summary(summary);
+    sim::Fingerprint same;
+    same.add_summary(summary);
+    sim::Fingerprint other;
+    other.add_summary(other_summary);
+
+    EXPECT_EQ(first.get_summary_hash(), same.get_summary_hash());
+    EXPECT_NE(first.get_summary_hash(), other.get_summary_hash());
+}
+
+}  // namespace test
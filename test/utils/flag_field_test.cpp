@@ -0,0 +1,94 @@
+#include "utils/flag_field.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "types.hpp"
+
+namespace test {
+
+class FlagFieldTest : public ::testing::Test {
+protected:
+    using FlagA = sim::FlagField<PacketFlagsBase, 0, 3>;
+    using FlagB = sim::NextFlagField<FlagA, 1>;
+    using FlagC = sim::NextFlagField<FlagB, 20>;
+    // Takes all remaining bits
+    using FlagD =
+        sim::NextFlagField<FlagC, sizeof_bits(PacketFlagsBase) - FlagC::M_END -
+                                      1>;
+
+    sim::BitSet<PacketFlagsBase> flags;
+};
+
+static int RANDOM_SEED = 42;
+
+TEST_F(FlagFieldTest, RequiredBits) {
+    static_assert(sim::required_bits_for_values(0) == 0);
+    static_assert(sim::required_bits_for_values(1) == 0);
+    static_assert(sim::required_bits_for_values(2) == 1);
+    static_assert(sim::required_bits_for_values(4) == 2);
+    static_assert(sim::required_bits_for_values(5) == 3);
+    static_assert(sim::required_bits_for_values(32) == 5);
+}
+
+TEST_F(FlagFieldTest, Layout) {
+    static_assert(FlagA::M_END == 4);
+    static_assert(FlagB::M_OFFSET == FlagA::M_END);
+    static_assert(FlagC::M_OFFSET == FlagB::M_END);
+    static_assert(FlagD::M_END == sizeof_bits(PacketFlagsBase));
+}
+
+TEST_F(FlagFieldTest, NotSetFlag) {
+    EXPECT_EQ(FlagA::get(flags), std::nullopt);
+    EXPECT_FALSE(FlagA::is_set(flags));
+
+    // zero value differs from unset field
+    EXPECT_TRUE(FlagA::set(flags, 0));
+    EXPECT_EQ(FlagA::get(flags), 0);
+    EXPECT_TRUE(FlagA::is_set(flags));
+    EXPECT_EQ(FlagB::get(flags), std::nullopt);
+}
+
+TEST_F(FlagFieldTest, SetAndGetFlag) {
+    std::mt19937_64 rnd(RANDOM_SEED);
+    auto a = rnd() % (FlagA::M_MAX_VALUE + 1);
+    auto b = rnd() % (FlagB::M_MAX_VALUE + 1);
+    auto c = rnd() % (FlagC::M_MAX_VALUE + 1);
+    auto d = rnd() % (FlagD::M_MAX_VALUE + 1);
+
+    EXPECT_TRUE(FlagA::set(flags, a));
+    EXPECT_TRUE(FlagB::set(flags, b));
+    EXPECT_TRUE(FlagC::set(flags, c));
+    EXPECT_TRUE(FlagD::set(flags, d));
+
+    EXPECT_EQ(FlagA::get(flags), a);
+    EXPECT_EQ(FlagB::get(flags), b);
+    EXPECT_EQ(FlagC::get(flags), c);
+    EXPECT_EQ(FlagD::get(flags), d);
+
+    // rewrite does not affect neighbours
+    EXPECT_TRUE(FlagB::set(flags, FlagB::M_MAX_VALUE - b));
+    EXPECT_EQ(FlagA::get(flags), a);
+    EXPECT_EQ(FlagB::get(flags), FlagB::M_MAX_VALUE - b);
+    EXPECT_EQ(FlagC::get(flags), c);
+}
+
+TEST_F(FlagFieldTest, ValueOutOfRange) {
+    EXPECT_TRUE(FlagA::set(flags, 5));
+    const PacketFlagsBase original = flags.get_bits();
+
+    EXPECT_FALSE(FlagA::set(flags, FlagA::M_MAX_VALUE + 1));
+    EXPECT_FALSE(FlagB::set(flags, 2));
+    EXPECT_EQ(flags.get_bits(), original);
+}
+
+TEST_F(FlagFieldTest, ResetFlag) {
+    EXPECT_TRUE(FlagA::set(flags, 7));
+    EXPECT_TRUE(FlagC::set(flags, 100));
+    FlagA::reset(flags);
+    EXPECT_EQ(FlagA::get(flags), std::nullopt);
+    EXPECT_EQ(FlagC::get(flags), 100);
+}
+
+}  // namespace test
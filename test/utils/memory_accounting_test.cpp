@@ -0,0 +1,87 @@
+#include "utils/memory_accounting.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "event/event.hpp"
+#include "link/packet_queue/simple_packet_queue.hpp"
+#include "scheduler.hpp"
+
+namespace test {
+
+class MemoryAccountingTest : public ::testing::Test {
+public:
+    void TearDown() override { sim::Scheduler::get_instance().clear(); };
+
+protected:
+    struct BigEvent : public sim::Event {
+        BigEvent(TimeNs a_time) : sim::Event(a_time) {}
+        void operator()() final {}
+
+        char payload[1000];
+    };
+};
+
+TEST_F(MemoryAccountingTest, ContainerMemoryIsReturned) {
+    using sim::MemorySubsystem;
+    std::size_t before = sim::MemoryAccounting::get_current(
+        MemorySubsystem::RoutingTables);
+    {
+        std::vector<int, sim::TrackingAllocator<
+                             int, MemorySubsystem::RoutingTables>>
+            values;
+        values.reserve(100);
+        EXPECT_EQ(
+            sim::MemoryAccounting::get_current(MemorySubsystem::RoutingTables),
+            before + 100 * sizeof(int));
+        EXPECT_GE(
+            sim::MemoryAccounting::get_peak(MemorySubsystem::RoutingTables),
+            before + 100 * sizeof(int));
+
+        auto copy = values;
+        copy.reserve(200);
+        EXPECT_EQ(
+            sim::MemoryAccounting::get_current(MemorySubsystem::RoutingTables),
+            before + 300 * sizeof(int));
+    }
+    EXPECT_EQ(
+        sim::MemoryAccounting::get_current(MemorySubsystem::RoutingTables),
+        before);
+}
+
+TEST_F(MemoryAccountingTest, EventsAreCountedBySize) {
+    using sim::MemorySubsystem;
+    std::size_t before =
+        sim::MemoryAccounting::get_current(MemorySubsystem::Events);
+    for (int i = 0; i < 10; i++) {
+        sim::Scheduler::get_instance().add<BigEvent>(TimeNs(i));
+    }
+    EXPECT_GE(sim::MemoryAccounting::get_current(MemorySubsystem::Events),
+              before + 10 * sizeof(BigEvent));
+
+    while (sim::Scheduler::get_instance().tick()) {
+    }
+    sim::Scheduler::get_instance().clear();
+    EXPECT_EQ(sim::MemoryAccounting::get_current(MemorySubsystem::Events),
+              before);
+}
+
+TEST_F(MemoryAccountingTest, PacketQueueMemoryFollowsPackets) {
+    using sim::MemorySubsystem;
+    std::size_t before =
+        sim::MemoryAccounting::get_current(MemorySubsystem::PacketQueues);
+    {
+        sim::SimplePacketQueue queue(SizeByte(1000000));
+        for (int i = 0; i < 1000; i++) {
+            queue.push(sim::Packet());
+        }
+        EXPECT_GE(
+            sim::MemoryAccounting::get_current(MemorySubsystem::PacketQueues),
+            before + 1000 * sizeof(sim::Packet));
+    }
+    EXPECT_EQ(sim::MemoryAccounting::get_current(MemorySubsystem::PacketQueues),
+              before);
+}
+
+}  // namespace test
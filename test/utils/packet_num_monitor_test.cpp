@@ -0,0 +1,109 @@
+#include "utils/packet_num_monitor.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <set>
+
+namespace test {
+
+class PacketNumMonitorTest : public ::testing::Test {
+protected:
+    // Straightforward model of expected behaviour
+    struct ModelMonitor {
+        bool confirm_one(PacketNum num) {
+            bool result =
+                num >= first_unconfirmed && confirmed.insert(num).second;
+            shift_first_unconfirmed();
+            return result;
+        }
+        std::size_t confirm_to(PacketNum num) {
+            std::size_t result = 0;
+            for (PacketNum i = first_unconfirmed; i <= num; i++) {
+                result += confirmed.insert(i).second;
+            }
+            shift_first_unconfirmed();
+            return result;
+        }
+        bool is_confirmed(PacketNum num) const {
+            return num < first_unconfirmed || confirmed.contains(num);
+        }
+        void shift_first_unconfirmed() {
+            while (confirmed.contains(first_unconfirmed)) {
+                confirmed.erase(first_unconfirmed++);
+            }
+        }
+        std::set<PacketNum> confirmed;
+        PacketNum first_unconfirmed = 0;
+    };
+};
+
+static int RANDOM_SEED = 42;
+
+TEST_F(PacketNumMonitorTest, ConfirmInOrder) {
+    sim::PacketNumMonitor monitor;
+    EXPECT_EQ(monitor.get_last_confirmed(), std::nullopt);
+    for (PacketNum i = 0; i < 5000; i++) {
+        EXPECT_TRUE(monitor.confirm_one(i));
+        EXPECT_EQ(monitor.get_first_unconfirmed(), i + 1);
+    }
+    EXPECT_EQ(monitor.get_last_confirmed(), 4999);
+    EXPECT_FALSE(monitor.confirm_one(10));
+    // window is not grown by in order confirmations
+    EXPECT_EQ(monitor.get_window_size(),
+              sim::PacketNumMonitor::M_DEFAULT_WINDOW_SIZE);
+}
+
+TEST_F(PacketNumMonitorTest, ConfirmWithGap) {
+    sim::PacketNumMonitor monitor(64);
+    EXPECT_TRUE(monitor.confirm_one(1));
+    EXPECT_TRUE(monitor.confirm_one(2));
+    EXPECT_FALSE(monitor.confirm_one(2));
+    EXPECT_EQ(monitor.get_first_unconfirmed(), 0);
+    EXPECT_TRUE(monitor.is_confirmed(2));
+    EXPECT_FALSE(monitor.is_confirmed(3));
+
+    EXPECT_TRUE(monitor.confirm_one(0));
+    EXPECT_EQ(monitor.get_first_unconfirmed(), 3);
+
+    // 3, 4 and 6 are confirmed by cumulative ack
+    EXPECT_TRUE(monitor.confirm_one(5));
+    EXPECT_EQ(monitor.confirm_to(6), 3);
+    EXPECT_EQ(monitor.get_first_unconfirmed(), 7);
+    EXPECT_EQ(monitor.confirm_to(6), 0);
+}
+
+TEST_F(PacketNumMonitorTest, GrowWindow) {
+    sim::PacketNumMonitor monitor(64);
+    EXPECT_TRUE(monitor.confirm_one(10));
+    EXPECT_TRUE(monitor.confirm_one(1000));
+    EXPECT_GE(monitor.get_window_size(), 1001);
+    EXPECT_TRUE(monitor.is_confirmed(10));
+    EXPECT_TRUE(monitor.is_confirmed(1000));
+    EXPECT_FALSE(monitor.is_confirmed(999));
+    EXPECT_EQ(monitor.confirm_to(1000), 999);
+}
+
+TEST_F(PacketNumMonitorTest, MatchesModel) {
+    std::mt19937 rnd(RANDOM_SEED);
+    sim::PacketNumMonitor monitor(64);
+    ModelMonitor model;
+
+    PacketNum sent = 0;
+    for (int step = 0; step < 20000; step++) {
+        PacketNum low = monitor.get_first_unconfirmed();
+        sent = std::max(sent, low) + rnd() % 3;
+        PacketNum num = low + rnd() % (sent - low + 100);
+        if (rnd() % 10 == 0) {
+            ASSERT_EQ(monitor.confirm_to(num), model.confirm_to(num));
+        } else {
+            ASSERT_EQ(monitor.confirm_one(num), model.confirm_one(num));
+        }
+        ASSERT_EQ(monitor.get_first_unconfirmed(), model.first_unconfirmed);
+        PacketNum probe = low + rnd() % (sent - low + 100);
+        ASSERT_EQ(monitor.is_confirmed(probe), model.is_confirmed(probe));
+    }
+}
+
+}  // namespace test
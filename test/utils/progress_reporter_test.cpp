@@ -0,0 +1,62 @@
+#include "utils/progress_reporter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace test {
+
+class ProgressReporter : public testing::Test {
+public:
+    void SetUp() override {
+        m_dir = std::filesystem::temp_directory_path() /
+                "nons_progress_reporter_test";
+        std::filesystem::remove_all(m_dir);
+    };
+    void TearDown() override { std::filesystem::remove_all(m_dir); };
+
+protected:
+    std::vector<std::string> read_lines(const std::filesystem::path& path) {
+        std::ifstream input(path);
+        std::vector<std::string> lines;
+        for (std::string line; std::getline(input, line);) {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+
+    std::filesystem::path m_dir;
+};
+
+TEST_F(ProgressReporter, ClockIsCheckedRarely) {
+    sim::ProgressReporter reporter(std::chrono::seconds(0), std::nullopt);
+    EXPECT_TRUE(reporter.is_report_due(4096));
+    EXPECT_FALSE(reporter.is_report_due(4097));
+
+    sim::ProgressReporter slow_reporter(std::chrono::hours(1), std::nullopt);
+    EXPECT_FALSE(slow_reporter.is_report_due(4096));
+}
+
+TEST_F(ProgressReporter, HeartbeatLines) {
+    std::filesystem::path path = m_dir / "progress.jsonl";
+    {
+        sim::ProgressReporter reporter(std::chrono::seconds(0), path);
+        reporter.report(sim::Progress{TimeNs(500), TimeNs(1000), 100, 10, 3});
+        reporter.report(sim::Progress{TimeNs(700), std::nullopt, 200, 5, 1});
+    }
+
+    std::vector<std::string> lines = read_lines(path);
+    ASSERT_EQ(lines.size(), 2);
+    EXPECT_NE(lines[0].find("\"simulated_time_ns\": 500,"), std::string::npos);
+    EXPECT_NE(lines[0].find("\"completed_part\": 0.5,"), std::string::npos);
+    EXPECT_NE(lines[0].find("\"pending_events\": 10,"), std::string::npos);
+    EXPECT_NE(lines[0].find("\"active_flows\": 3}"), std::string::npos);
+    EXPECT_NE(lines[1].find("\"completed_part\": null,"), std::string::npos);
+    EXPECT_NE(lines[1].find("\"eta_s\": null,"), std::string::npos);
+    EXPECT_NE(lines[1].find("\"processed_events\": 200,"), std::string::npos);
+}
+
+}  // namespace test
@@ -0,0 +1,61 @@
+#include "utils/quantile_sketch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "utils/random_stream.hpp"
+
+namespace test {
+
+class QuantileSketch : public testing::Test {
+public:
+    void TearDown() override {};
+    void SetUp() override {};
+};
+
+TEST_F(QuantileSketch, EmptySketch) {
+    sim::QuantileSketch sketch;
+    EXPECT_EQ(sketch.get_count(), 0);
+    EXPECT_TRUE(std::isnan(sketch.get_quantile(0.5)));
+    EXPECT_TRUE(std::isnan(sketch.get_mean()));
+}
+
+TEST_F(QuantileSketch, RelativeErrorIsBounded) {
+    const double accuracy = 0.01;
+    sim::QuantileSketch sketch(accuracy);
+    std::vector<double> values;
+    sim::RandomStream stream(1);
+    // Heavy-tailed values spanning several orders of magnitude
+    for (int i = 0; i < 100'000; i++) {
+        double value = std::exp(12 * stream.next_double());
+        values.push_back(value);
+        sketch.add(value);
+    }
+    std::sort(values.begin(), values.end());
+
+    EXPECT_EQ(sketch.get_count(), values.size());
+    EXPECT_EQ(sketch.get_min(), values.front());
+    EXPECT_EQ(sketch.get_max(), values.back());
+    for (double q : {0.0, 0.1, 0.5, 0.9, 0.99, 0.999, 1.0}) {
+        std::size_t rank = q * (values.size() - 1);
+        double exact = values[rank];
+        EXPECT_NEAR(sketch.get_quantile(q), exact, exact * accuracy) << q;
+    }
+}
+
+TEST_F(QuantileSketch, NonPositiveValues) {
+    sim::QuantileSketch sketch;
+    sketch.add(0);
+    sketch.add(0);
+    sketch.add(10);
+    sketch.add(std::nan(""));
+
+    EXPECT_EQ(sketch.get_count(), 3);
+    EXPECT_EQ(sketch.get_quantile(0.5), 0);
+    EXPECT_EQ(sketch.get_quantile(1), 10);
+}
+
+}  // namespace test
@@ -0,0 +1,87 @@
+#include "utils/random_stream.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace test {
+
+class RandomStream : public testing::Test {
+public:
+    void TearDown() override { sim::RandomStream::set_global_seed(0); };
+    void SetUp() override {};
+};
+
+static std::vector<std::uint64_t> take(sim::RandomStream stream,
+                                       std::size_t count) {
+    std::vector<std::uint64_t> values;
+    for (std::size_t i = 0; i < count; i++) {
+        values.push_back(stream());
+    }
+    return values;
+}
+
+TEST_F(RandomStream, StreamsAreGivenByKeyAndGlobalSeed) {
+    std::vector<std::uint64_t> first = take(sim::RandomStream(1), 100);
+    EXPECT_EQ(take(sim::RandomStream(1), 100), first);
+    EXPECT_NE(take(sim::RandomStream(2), 100), first);
+
+    sim::RandomStream::set_global_seed(42);
+    EXPECT_NE(take(sim::RandomStream(1), 100), first);
+    sim::RandomStream::set_global_seed(0);
+    EXPECT_EQ(take(sim::RandomStream(1), 100), first);
+}
+
+TEST_F(RandomStream, UniformDoubles) {
+    sim::RandomStream stream(7);
+    const int samples = 100'000;
+    double sum = 0;
+    for (int i = 0; i < samples; i++) {
+        double value = stream.next_double();
+        ASSERT_GE(value, 0.0);
+        ASSERT_LT(value, 1.0);
+        sum += value;
+    }
+    EXPECT_NEAR(sum / samples, 0.5, 0.01);
+}
+
+TEST_F(RandomStream, BoundedIntegers) {
+    sim::RandomStream stream(7);
+    const int samples = 100'000;
+    std::vector<int> counts(3, 0);
+    for (int i = 0; i < samples; i++) {
+        std::uint64_t value = stream.next_below(3);
+        ASSERT_LT(value, 3);
+        counts[value]++;
+    }
+    for (int count : counts) {
+        EXPECT_NEAR(count, samples / 3.0, samples * 0.01);
+    }
+    // Bound close to 2^64 rejects almost half of values
+    const std::uint64_t large_bound = (1ull << 63) + 1;
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_LT(stream.next_below(large_bound), large_bound);
+    }
+    EXPECT_EQ(stream.next_below(1), 0);
+}
+
+TEST_F(RandomStream, ExponentialByInverseCdf) {
+    sim::RandomStream stream(7);
+    const int samples = 100'000;
+    const double mean = 250;
+    double sum = 0;
+    int above_mean = 0;
+    for (int i = 0; i < samples; i++) {
+        double value = stream.next_exponential(mean);
+        ASSERT_GE(value, 0.0);
+        ASSERT_TRUE(std::isfinite(value));
+        sum += value;
+        above_mean += value > mean;
+    }
+    EXPECT_NEAR(sum / samples, mean, mean * 0.02);
+    // P(X > mean) = 1 / e
+    EXPECT_NEAR(static_cast<double>(above_mean) / samples, std::exp(-1), 0.01);
+}
+
+}  // namespace test
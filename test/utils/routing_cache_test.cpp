@@ -0,0 +1,102 @@
+#include "utils/routing_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <set>
+
+#include "../simulator/utils.hpp"
+
+namespace test {
+
+class RoutingCache : public testing::Test {
+public:
+    void TearDown() override {
+        sim::IdentifierFactory::get_instance().clear();
+        std::filesystem::remove_all(m_cache_dir);
+    };
+    void SetUp() override {
+        sim::IdentifierFactory::get_instance().clear();
+        m_cache_dir =
+            std::filesystem::temp_directory_path() / "nons_routing_cache_test";
+        std::filesystem::remove_all(m_cache_dir);
+    };
+
+protected:
+    std::filesystem::path m_cache_dir;
+};
+
+static const std::string FAT_TREE = "generated_fat_tree_topology.yml";
+
+static sim::RoutingCache create_cache(const sim::Simulator& simulator,
+                                      const std::filesystem::path& dir) {
+    std::vector<std::shared_ptr<sim::ILink>> links =
+        sim::IdentifierFactory::get_instance().get_objects<sim::ILink>();
+    return sim::RoutingCache(dir, simulator.get_devices(), links);
+}
+
+// For every pair of devices returns ids of links device chooses for packets
+// to destination
+static std::map<std::pair<Id, Id>, std::set<Id>> get_routes(
+    const sim::Simulator& simulator) {
+    std::map<std::pair<Id, Id>, std::set<Id>> routes;
+    auto devices = simulator.get_devices();
+    for (const auto& src : devices) {
+        for (const auto& dest : devices) {
+            if (src == dest) {
+                continue;
+            }
+            auto& links = routes[{src->get_id(), dest->get_id()}];
+            // enough flows to hit every equal-cost link
+            for (sim::HeaderHash flow_hash = 0; flow_hash < 256; flow_hash++) {
+                sim::Packet packet(SizeByte(0), nullptr, src->get_id(),
+                                   dest->get_id());
+                packet.flow_hash = flow_hash;
+                auto link = src->get_link_to_destination(packet);
+                links.insert(link == nullptr ? "" : link->get_id());
+            }
+        }
+    }
+    return routes;
+}
+
+TEST_F(RoutingCache, SameTopologySameHash) {
+    sim::Simulator first = build_simulator(FAT_TREE);
+    std::uint64_t hash = create_cache(first, m_cache_dir).get_topology_hash();
+    sim::Simulator second = build_simulator(FAT_TREE);
+    EXPECT_EQ(create_cache(second, m_cache_dir).get_topology_hash(), hash);
+    sim::Simulator other = build_simulator("mesh_topology.yml");
+    EXPECT_NE(create_cache(other, m_cache_dir).get_topology_hash(), hash);
+}
+
+TEST_F(RoutingCache, LoadedTablesMatchComputed) {
+    sim::Simulator computed = build_simulator(FAT_TREE);
+    computed.set_routing_cache_dir(m_cache_dir);
+    EXPECT_FALSE(create_cache(computed, m_cache_dir).load());
+    computed.recalculate_paths();
+    auto computed_routes = get_routes(computed);
+    EXPECT_TRUE(std::filesystem::exists(
+        create_cache(computed, m_cache_dir).get_file_path()));
+
+    sim::Simulator loaded = build_simulator(FAT_TREE);
+    EXPECT_TRUE(create_cache(loaded, m_cache_dir).load());
+    EXPECT_EQ(get_routes(loaded), computed_routes);
+}
+
+TEST_F(RoutingCache, CorruptedFileIgnored) {
+    sim::Simulator simulator = build_simulator(FAT_TREE);
+    auto path = create_cache(simulator, m_cache_dir).get_file_path();
+    std::filesystem::create_directories(m_cache_dir);
+    std::ofstream(path) << "not a routing table";
+    EXPECT_FALSE(create_cache(simulator, m_cache_dir).load());
+
+    // cache is rewritten with correct tables
+    simulator.set_routing_cache_dir(m_cache_dir);
+    simulator.recalculate_paths();
+    sim::Simulator loaded = build_simulator(FAT_TREE);
+    EXPECT_TRUE(create_cache(loaded, m_cache_dir).load());
+}
+
+}  // namespace test